@@ -0,0 +1,271 @@
+/*
+ * SortedIntersection.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_AUXILIARY_SORTED_INTERSECTION_HPP_
+#define NETWORKIT_AUXILIARY_SORTED_INTERSECTION_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace Aux {
+
+/**
+ * Intersection kernels for sorted sequences of unique values, e.g., sorted neighborhoods. All
+ * functions pick a kernel based on the size ratio of the inputs: strongly unbalanced inputs are
+ * intersected by galloping (exponential) search from the smaller into the larger sequence, the
+ * remaining ones by a linear merge. For 64-bit integers the merge is replaced by a block-wise
+ * all-pairs comparison with AVX-512 or AVX2 if the library is compiled for a target supporting
+ * these instruction sets (e.g., with NETWORKIT_NATIVE).
+ */
+namespace SortedIntersection {
+
+/// Size ratio from which on galloping search is preferred over a (vectorized) merge.
+constexpr size_t gallopingThreshold = 32;
+
+namespace Impl {
+
+// Calls handle(i, j) for all positions with a[i] == b[j], starting at positions ia and ib.
+template <typename T, typename F>
+void merge(const T *a, size_t sizeA, const T *b, size_t sizeB, size_t ia, size_t ib, F &handle) {
+    while (ia < sizeA && ib < sizeB) {
+        if (a[ia] < b[ib]) {
+            ++ia;
+        } else if (b[ib] < a[ia]) {
+            ++ib;
+        } else {
+            handle(ia++, ib++);
+        }
+    }
+}
+
+// Searches every element of the small sequence in the large one. The search range grows
+// exponentially starting from the last match and is then narrowed by a binary search.
+template <typename T, typename F>
+void gallop(const T *small, size_t sizeSmall, const T *large, size_t sizeLarge, F &handle) {
+    size_t lo = 0;
+    for (size_t i = 0; i < sizeSmall && lo < sizeLarge; ++i) {
+        const T x = small[i];
+        size_t step = 1, hi = lo;
+        while (hi < sizeLarge && large[hi] < x) {
+            lo = hi + 1;
+            hi += step;
+            step <<= 1;
+        }
+        hi = std::min(hi + 1, sizeLarge);
+        lo = std::lower_bound(large + lo, large + hi, x) - large;
+        if (lo < sizeLarge && large[lo] == x)
+            handle(i, lo++);
+    }
+}
+
+inline unsigned popcount(unsigned mask) {
+    unsigned result = 0;
+    for (; mask; mask &= mask - 1)
+        ++result;
+    return result;
+}
+
+// Reports all matches of a block of a (given by the bit mask) against the block of b.
+template <typename T, typename F>
+void reportBlock(const T *a, const T *b, size_t ia, size_t ib, size_t width, unsigned mask,
+                 F &handle) {
+    for (size_t k = 0; k < width; ++k) {
+        if (!(mask & (1u << k)))
+            continue;
+        for (size_t l = 0; l < width; ++l) {
+            if (b[ib + l] == a[ia + k]) {
+                handle(ia + k, ib + l);
+                break;
+            }
+        }
+    }
+}
+
+#if defined(__AVX512F__)
+
+constexpr size_t simdWidth = 8;
+
+// Bit k of the result is set iff a[k] occurs in b[0..7].
+inline unsigned blockMatches(const void *a, const void *b) {
+    const __m512i va = _mm512_loadu_si512(a);
+    const __m512i vb = _mm512_loadu_si512(b);
+    __mmask8 mask = _mm512_cmpeq_epi64_mask(va, vb);
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 1));
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 2));
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 3));
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 4));
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 5));
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 6));
+    mask |= _mm512_cmpeq_epi64_mask(va, _mm512_alignr_epi64(vb, vb, 7));
+    return mask;
+}
+
+#elif defined(__AVX2__)
+
+constexpr size_t simdWidth = 4;
+
+// Bit k of the result is set iff a[k] occurs in b[0..3].
+inline unsigned blockMatches(const void *a, const void *b) {
+    const __m256i va = _mm256_loadu_si256(static_cast<const __m256i *>(a));
+    const __m256i vb = _mm256_loadu_si256(static_cast<const __m256i *>(b));
+    __m256i cmp = _mm256_cmpeq_epi64(va, vb);
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(cmp)));
+}
+
+#endif
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+
+// Block-wise intersection: compares a block of a against all rotations of a block of b and
+// advances the block(s) with the smaller maximum. The remainder is handled by a merge.
+template <bool countOnly, typename T, typename F>
+size_t block(const T *a, size_t sizeA, const T *b, size_t sizeB, F &handle, std::true_type) {
+    size_t ia = 0, ib = 0, found = 0;
+    const size_t endA = sizeA - sizeA % simdWidth, endB = sizeB - sizeB % simdWidth;
+    while (ia < endA && ib < endB) {
+        const unsigned mask = blockMatches(a + ia, b + ib);
+        if (mask) {
+            if (countOnly)
+                found += popcount(mask);
+            else
+                reportBlock(a, b, ia, ib, simdWidth, mask, handle);
+        }
+
+        const T maxA = a[ia + simdWidth - 1], maxB = b[ib + simdWidth - 1];
+        if (maxA <= maxB)
+            ia += simdWidth;
+        if (maxB <= maxA)
+            ib += simdWidth;
+    }
+
+    if (countOnly) {
+        auto counter = [&](size_t, size_t) { ++found; };
+        merge(a, sizeA, b, sizeB, ia, ib, counter);
+    } else {
+        merge(a, sizeA, b, sizeB, ia, ib, handle);
+    }
+    return found;
+}
+
+#endif
+
+// Fallback for value types that are not 64-bit integers or targets without SIMD support.
+template <bool countOnly, typename T, typename F>
+size_t block(const T *a, size_t sizeA, const T *b, size_t sizeB, F &handle, std::false_type) {
+    size_t found = 0;
+    if (countOnly) {
+        auto counter = [&](size_t, size_t) { ++found; };
+        merge(a, sizeA, b, sizeB, 0, 0, counter);
+    } else {
+        merge(a, sizeA, b, sizeB, 0, 0, handle);
+    }
+    return found;
+}
+
+template <typename T>
+using UseSIMD = std::integral_constant<bool,
+#if defined(__AVX512F__) || defined(__AVX2__)
+                                       std::is_integral<T>::value && sizeof(T) == 8
+#else
+                                       false
+#endif
+                                       >;
+
+template <bool countOnly, typename T, typename F>
+size_t dispatch(const T *a, size_t sizeA, const T *b, size_t sizeB, F &handle) {
+    if (!sizeA || !sizeB)
+        return 0;
+
+    if (sizeA * gallopingThreshold <= sizeB || sizeB * gallopingThreshold <= sizeA) {
+        size_t found = 0;
+        auto report = [&](size_t i, size_t j) {
+            if (countOnly)
+                ++found;
+            else
+                handle(i, j);
+        };
+        if (sizeA <= sizeB) {
+            gallop(a, sizeA, b, sizeB, report);
+        } else {
+            auto swapped = [&](size_t j, size_t i) { report(i, j); };
+            gallop(b, sizeB, a, sizeA, swapped);
+        }
+        return found;
+    }
+
+    return block<countOnly>(a, sizeA, b, sizeB, handle, UseSIMD<T>{});
+}
+
+} // namespace Impl
+
+/**
+ * Calls @a handle(i, j) for all positions i and j with a[i] == b[j]. The positions are reported in
+ * increasing order. Both sequences must be sorted and must not contain duplicates.
+ *
+ * @param a Pointer to the first sequence.
+ * @param sizeA Length of the first sequence.
+ * @param b Pointer to the second sequence.
+ * @param sizeB Length of the second sequence.
+ * @param handle Callback taking the positions of a common element in @a a and @a b.
+ */
+template <typename T, typename F>
+void forIntersection(const T *a, size_t sizeA, const T *b, size_t sizeB, F handle) {
+    Impl::dispatch<false>(a, sizeA, b, sizeB, handle);
+}
+
+/**
+ * Returns the number of elements that occur in both sorted sequences @a a and @a b.
+ */
+template <typename T>
+size_t intersectionSize(const T *a, size_t sizeA, const T *b, size_t sizeB) {
+    auto ignore = [](size_t, size_t) {};
+    return Impl::dispatch<true>(a, sizeA, b, sizeB, ignore);
+}
+
+template <typename T>
+size_t intersectionSize(const std::vector<T> &a, const std::vector<T> &b) {
+    return intersectionSize(a.data(), a.size(), b.data(), b.size());
+}
+
+/**
+ * Writes the elements that occur in both sorted sequences @a a and @a b in increasing order to
+ * @a out and returns the iterator past the last written element.
+ */
+template <typename T, typename OutputIt>
+OutputIt intersect(const T *a, size_t sizeA, const T *b, size_t sizeB, OutputIt out) {
+    forIntersection(a, sizeA, b, sizeB, [&](size_t i, size_t) { *out++ = a[i]; });
+    return out;
+}
+
+template <typename T>
+std::vector<T> intersect(const std::vector<T> &a, const std::vector<T> &b) {
+    std::vector<T> result;
+    result.reserve(std::min(a.size(), b.size()));
+    intersect(a.data(), a.size(), b.data(), b.size(), std::back_inserter(result));
+    return result;
+}
+
+} // namespace SortedIntersection
+
+} // namespace Aux
+
+#endif // NETWORKIT_AUXILIARY_SORTED_INTERSECTION_HPP_
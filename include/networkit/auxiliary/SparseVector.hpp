@@ -0,0 +1,119 @@
+/*
+ * SparseVector.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_AUXILIARY_SPARSE_VECTOR_HPP_
+#define NETWORKIT_AUXILIARY_SPARSE_VECTOR_HPP_
+
+#include <cassert>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+
+namespace Aux {
+
+/**
+ * Dense vector that keeps track of the indices that have been written since the last reset. Resets
+ * take time proportional to the number of used indices instead of the size of the vector, which
+ * makes it suitable as a reusable (e.g., per-thread) accumulator, for instance for the weights of
+ * the edges from a node to the neighboring communities.
+ *
+ * An index is considered used iff its value differs from the empty value; hence, the value of a
+ * used index must never be set to the empty value (e.g., use -1 as empty value for non-negative
+ * sums).
+ */
+template <typename T>
+class SparseVector {
+public:
+    SparseVector() = default;
+
+    /**
+     * Creates a vector of the given size where all entries hold @a emptyValue.
+     */
+    explicit SparseVector(NetworKit::index size, T emptyValue = T{})
+        : data(size, emptyValue), emptyValue(emptyValue) {}
+
+    /**
+     * Resizes the vector; all entries (old and new) hold the empty value afterwards.
+     */
+    void resize(NetworKit::index size, T newEmptyValue = T{}) {
+        emptyValue = newEmptyValue;
+        data.assign(size, emptyValue);
+        used.clear();
+    }
+
+    /**
+     * Returns the size of the underlying dense vector.
+     */
+    NetworKit::count upperBound() const noexcept { return data.size(); }
+
+    /**
+     * Returns the number of used indices.
+     */
+    NetworKit::count size() const noexcept { return used.size(); }
+
+    /**
+     * Returns true iff index @a i has been inserted since the last reset.
+     */
+    bool indexIsUsed(NetworKit::index i) const {
+        assert(i < data.size());
+        return data[i] != emptyValue;
+    }
+
+    /**
+     * Marks index @a i as used and sets its value. The index must not be in use and @a value must
+     * differ from the empty value.
+     */
+    void insert(NetworKit::index i, T value) {
+        assert(!indexIsUsed(i));
+        assert(value != emptyValue);
+        data[i] = value;
+        used.push_back(i);
+    }
+
+    T &operator[](NetworKit::index i) {
+        assert(i < data.size());
+        return data[i];
+    }
+
+    const T &operator[](NetworKit::index i) const {
+        assert(i < data.size());
+        return data[i];
+    }
+
+    /**
+     * Returns the used indices in the order of insertion.
+     */
+    const std::vector<NetworKit::index> &usedIndices() const noexcept { return used; }
+
+    /**
+     * Calls @a handle(index, value) for all used indices.
+     */
+    template <typename F>
+    void forElements(F handle) const {
+        for (const NetworKit::index i : used)
+            handle(i, data[i]);
+    }
+
+    /**
+     * Sets all used entries back to the empty value in O(size()) time.
+     */
+    void reset() {
+        for (const NetworKit::index i : used)
+            data[i] = emptyValue;
+        used.clear();
+    }
+
+private:
+    std::vector<T> data;
+    std::vector<NetworKit::index> used;
+    T emptyValue{};
+};
+
+} // namespace Aux
+
+#endif // NETWORKIT_AUXILIARY_SPARSE_VECTOR_HPP_
@@ -0,0 +1,148 @@
+/*
+ * ApproxLocalClusteringCoefficient.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_CENTRALITY_APPROX_LOCAL_CLUSTERING_COEFFICIENT_HPP_
+#define NETWORKIT_CENTRALITY_APPROX_LOCAL_CLUSTERING_COEFFICIENT_HPP_
+
+#include <vector>
+
+#include <networkit/centrality/Centrality.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Approximation of the local clustering coefficients by wedge sampling. For every node u, pairs of
+ * distinct neighbors (wedges centered at u) are sampled uniformly at random and the fraction of
+ * closed wedges (i.e., the neighbors are adjacent) is reported as estimate of c(u). By Hoeffding's
+ * inequality, O(log(1/delta) / epsilon^2) samples suffice for an additive error of at most
+ * @a epsilon with probability at least (1 - @a delta). Nodes with at most that many wedges are
+ * evaluated exactly.
+ *
+ * Besides the per-node estimates, the algorithm reports estimates of the average local clustering
+ * coefficient of every degree class, where degree class i contains the nodes with a degree in
+ * [2^i, 2^(i+1)) (nodes of degree 0 belong to class 0). All estimates come with confidence bounds
+ * that hold with probability at least (1 - @a delta) each.
+ *
+ * The samples are drawn in parallel in rounds of growing size. If a time limit is given, no new
+ * round is started once it is exceeded; the bounds then reflect the samples taken so far.
+ */
+class ApproxLocalClusteringCoefficient final : public Centrality {
+
+public:
+    /**
+     * Constructs the ApproxLocalClusteringCoefficient class for the given undirected graph @a G.
+     * The graph may not contain self-loops.
+     *
+     * @param G The graph.
+     * @param epsilon Maximum additive error of the per-node estimates.
+     * @param delta Probability that an estimate violates its error bound.
+     * @param timeLimit Time budget in milliseconds, 0 means no limit. At least one round of
+     * samples is always taken.
+     */
+    ApproxLocalClusteringCoefficient(const Graph &G, double epsilon = 0.01, double delta = 0.1,
+                                     count timeLimit = 0);
+
+    /**
+     * Estimates the local clustering coefficients of all nodes.
+     */
+    void run() override;
+
+    /**
+     * Returns the lower confidence bounds of the local clustering coefficients.
+     */
+    const std::vector<double> &getLowerBounds() const {
+        assureFinished();
+        return lowerBounds;
+    }
+
+    /**
+     * Returns the upper confidence bounds of the local clustering coefficients.
+     */
+    const std::vector<double> &getUpperBounds() const {
+        assureFinished();
+        return upperBounds;
+    }
+
+    /**
+     * Returns the estimated average local clustering coefficient of every degree class.
+     */
+    const std::vector<double> &getDegreeClassScores() const {
+        assureFinished();
+        return classScores;
+    }
+
+    /**
+     * Returns the lower confidence bounds of the average local clustering coefficient of every
+     * degree class.
+     */
+    const std::vector<double> &getDegreeClassLowerBounds() const {
+        assureFinished();
+        return classLowerBounds;
+    }
+
+    /**
+     * Returns the upper confidence bounds of the average local clustering coefficient of every
+     * degree class.
+     */
+    const std::vector<double> &getDegreeClassUpperBounds() const {
+        assureFinished();
+        return classUpperBounds;
+    }
+
+    /**
+     * Returns the number of nodes of every degree class.
+     */
+    const std::vector<count> &getDegreeClassSizes() const {
+        assureFinished();
+        return classSizes;
+    }
+
+    /**
+     * Returns the degree class of a node with degree @a deg.
+     */
+    static index degreeClass(count deg) noexcept;
+
+    /**
+     * Returns the total number of wedges that were checked (sampled or exact).
+     */
+    count numberOfSamples() const {
+        assureFinished();
+        return totalSamples;
+    }
+
+    /**
+     * Returns true iff all nodes received the number of samples that is required for the error
+     * bound @a epsilon, i.e., the time limit was not hit.
+     */
+    bool reachedErrorBound() const {
+        assureFinished();
+        return errorBoundReached;
+    }
+
+    /**
+     * Get the theoretical maximum of centrality score in the given graph.
+     *
+     * @return The maximum centrality score.
+     */
+    double maximum() override { return 1.0; }
+
+private:
+    const double epsilon, delta;
+    const count timeLimit;
+
+    std::vector<double> lowerBounds, upperBounds;
+    std::vector<double> classScores, classLowerBounds, classUpperBounds;
+    std::vector<count> classSizes;
+    count totalSamples = 0;
+    bool errorBoundReached = false;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_APPROX_LOCAL_CLUSTERING_COEFFICIENT_HPP_
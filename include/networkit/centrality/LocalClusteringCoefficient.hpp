@@ -21,19 +21,17 @@ public:
      * Constructs the LocalClusteringCoefficient class for the given Graph @a G. If the local clustering coefficient scores should be normalized,
      * then set @a normalized to <code>true</code>. The graph may not contain self-loops.
      *
-     * There are two algorithms available. The trivial (parallel) algorithm needs only a small amount of additional memory.
-     * The turbo mode adds a (sequential, but fast) pre-processing step using ideas from [0]. This reduces the running time
-     * significantly for most graphs. However, the turbo mode needs O(m) additional memory. In practice this should be a bit
-     * less than half of the memory that is needed for the graph itself. The turbo mode is particularly effective for graphs
-     * with nodes of very high degree and a very skewed degree distribution.
+     * The edges are oriented from lower to higher degree (see OrientedGraph) and every triangle is listed exactly
+     * once by intersecting the out-neighborhoods of the endpoints of an oriented edge, using ideas from [0]. This
+     * needs O(m^1.5) work and O(m) additional memory and is particularly effective for graphs with nodes of very
+     * high degree and a very skewed degree distribution.
      *
      * [0] Triangle Listing Algorithms: Back from the Diversion
-     * Mark Ortmann and Ulrik Brandes                                                                          *
+     * Mark Ortmann and Ulrik Brandes
      * 2014 Proceedings of the Sixteenth Workshop on Algorithm Engineering and Experiments (ALENEX). 2014, 1-8
      *
      * @param G The graph.
-     * @param turbo If the turbo mode shall be activated.
-     * TODO running time
+     * @param turbo Kept for compatibility; has no effect since the oriented algorithm is always used.
      */
     LocalClusteringCoefficient(const Graph &G, bool turbo = false);
 
@@ -10,6 +10,9 @@
 #ifndef NETWORKIT_CENTRALITY_TOP_CLOSENESS_HPP_
 #define NETWORKIT_CENTRALITY_TOP_CLOSENESS_HPP_
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <memory>
 
 #include <networkit/base/Algorithm.hpp>
@@ -92,9 +95,16 @@ private:
 
     std::unique_ptr<StronglyConnectedComponents> sccsPtr;
 
+    // Per-thread BFS state. A node is visited in the current BFS iff its entry in visitedGlobal
+    // equals the timestamp of the thread, hence the arrays do not have to be reset.
+    std::vector<std::vector<uint16_t>> visitedGlobal;
+    std::vector<uint16_t> tsGlobal;
+    std::vector<std::vector<node>> queueGlobal, predGlobal;
+    std::vector<std::vector<count>> distGlobal;
+
     void init();
-    double BFScut(node v, double x, std::vector<bool> &visited, std::vector<count> &distances,
-                  std::vector<node> &pred, count &visEdges);
+    void updateTimestamp();
+    double BFScut(node v, const std::atomic<double> &kth, count &visEdges);
     void computelBound1(std::vector<double> &S);
     void BFSbound(node x, std::vector<double> &S, count &visEdges,
                   const std::vector<bool> &toAnalyze);
@@ -10,6 +10,8 @@
 
 // networkit-format
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 #include <networkit/base/Algorithm.hpp>
@@ -84,23 +86,24 @@ private:
 
     std::vector<double> hCloseness;
     std::vector<count> reachableNodes;
-    std::vector<std::vector<uint8_t>> visitedGlobal;
-    std::vector<uint8_t> tsGlobal;
+    // Per-thread search state. A node is visited in the current search iff its entry in
+    // visitedGlobal equals the timestamp of the thread, hence the arrays do not have to be reset.
+    std::vector<std::vector<uint16_t>> visitedGlobal;
+    std::vector<uint16_t> tsGlobal;
+    std::vector<std::vector<node>> queueGlobal;
 
     std::vector<node> topKNodes;
     std::vector<double> topKScores;
 
-    // For NBbound
+    // For NBbound: the BFS order is stored in queueGlobal, levelStartGlobal contains the
+    // position of the first node of every level.
     std::vector<count> reachU, reachL;
-    std::vector<std::vector<count>> numberOfNodesAtLevelGlobal;
-    std::vector<std::vector<node>> nodesAtCurrentLevelGlobal;
-    std::vector<std::vector<std::vector<node>>> nodesAtLevelGlobal;
-    std::vector<double> levelImprovement;
+    std::vector<std::vector<index>> levelStartGlobal;
     std::unique_ptr<WeaklyConnectedComponents> wccPtr;
     void updateTimestamp() {
         auto &visited = visitedGlobal[omp_get_thread_num()];
         auto &ts = tsGlobal[omp_get_thread_num()];
-        if (ts++ == std::numeric_limits<uint8_t>::max()) {
+        if (ts++ == std::numeric_limits<uint16_t>::max()) {
             ts = 1;
             std::fill(visited.begin(), visited.end(), 0);
         }
@@ -133,8 +136,8 @@ private:
 
     void runNBcut();
     void runNBbound();
-    bool bfscutUnweighted(node source, double kthCloseness);
-    bool bfscutWeighted(node source, double kthCloseness);
+    bool bfscutUnweighted(node source, const std::atomic<double> &kthCloseness);
+    bool bfscutWeighted(node source, const std::atomic<double> &kthCloseness);
     void bfsbound(node source);
     void computeReachableNodes();
     void computeReachableNodesBounds();
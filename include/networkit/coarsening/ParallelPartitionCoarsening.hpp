@@ -8,6 +8,8 @@
 #ifndef NETWORKIT_COARSENING_PARALLEL_PARTITION_COARSENING_HPP_
 #define NETWORKIT_COARSENING_PARALLEL_PARTITION_COARSENING_HPP_
 
+#include <vector>
+
 #include <networkit/Globals.hpp>
 #include <networkit/coarsening/GraphCoarsening.hpp>
 #include <networkit/structures/Partition.hpp>
@@ -16,16 +18,40 @@ namespace NetworKit {
 
 /**
  * @ingroup coarsening
+ * Contracts every subset of a partition into a supernode. The edges between two supernodes are
+ * merged into one edge whose weight is the total weight of the merged edges; the edges inside a
+ * supernode become a self-loop.
  */
 class ParallelPartitionCoarsening final : public GraphCoarsening {
 public:
+    /**
+     * @param[in] G fine graph
+     * @param[in] zeta partition whose subsets become the supernodes
+     * @param[in] useGraphBuilder unused, kept for compatibility; all contractions are performed
+     * by contract()
+     */
     ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder = true);
 
     void run() override;
 
+    /**
+     * Contracts @a G according to @a nodeToSuperNode, which maps every node of @a G to a supernode
+     * id in [0, @a numberOfSuperNodes). The fine nodes are bucketed by their supernode and the
+     * edges of every supernode are aggregated by a thread-local sparse accumulator, which writes
+     * the coarse adjacency directly. Hence, the running time is linear in the size of @a G and the
+     * additional memory is O(numberOfSuperNodes) per thread.
+     *
+     * @param[in] G fine graph
+     * @param[in] nodeToSuperNode mapping from the nodes of @a G to the supernodes
+     * @param[in] numberOfSuperNodes number of supernodes
+     * @param[in] noSelfLoops if true, the edges inside supernodes are dropped
+     * @return the weighted, undirected coarse graph
+     */
+    static Graph contract(const Graph& G, const std::vector<node>& nodeToSuperNode,
+                          count numberOfSuperNodes, bool noSelfLoops = false);
+
 private:
     const Partition& zeta;
-    bool useGraphBuilder;
 };
 
 } /* namespace NetworKit */
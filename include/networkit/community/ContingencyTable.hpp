@@ -0,0 +1,125 @@
+/*
+ * ContingencyTable.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMMUNITY_CONTINGENCY_TABLE_HPP_
+#define NETWORKIT_COMMUNITY_CONTINGENCY_TABLE_HPP_
+
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Sparse contingency table of two partitions zeta and eta: for every pair of subsets (C, D) with
+ * C in zeta and D in eta that have at least one element in common, the table stores the size of
+ * their intersection. Only elements that are assigned in both partitions are counted.
+ *
+ * The table is built in parallel: the elements are counting-sorted by their subset in zeta, then
+ * every bucket is sorted by the subsets in eta and collapsed to its nonempty entries. The entries
+ * are ordered by (C, D).
+ *
+ * The table needs memory proportional to the upper bounds of both partitions; partitions with
+ * sparse subset ids, e.g., hashes, should be compacted first.
+ */
+class ContingencyTable final {
+
+public:
+    /**
+     * Builds the table for the nodes of @a G.
+     */
+    ContingencyTable(const Graph &G, const Partition &zeta, const Partition &eta);
+
+    /**
+     * Builds the table for all elements of @a zeta and @a eta.
+     */
+    ContingencyTable(const Partition &zeta, const Partition &eta);
+
+    /**
+     * Returns the number of counted elements.
+     */
+    count numberOfElements() const noexcept { return numElements; }
+
+    /**
+     * Returns the number of nonempty entries.
+     */
+    count numberOfEntries() const noexcept { return entrySizes.size(); }
+
+    /**
+     * Returns the subset of the first partition of entry @a i.
+     */
+    index firstSubset(index i) const { return firstSubsets[i]; }
+
+    /**
+     * Returns the subset of the second partition of entry @a i.
+     */
+    index secondSubset(index i) const { return secondSubsets[i]; }
+
+    /**
+     * Returns the size of entry @a i, i.e., the size of the intersection of its subsets.
+     */
+    count entrySize(index i) const { return entrySizes[i]; }
+
+    /**
+     * Returns the entry of element @a e or none if @a e has not been counted.
+     */
+    index entryOf(index e) const { return e < entry.size() ? entry[e] : none; }
+
+    /**
+     * Returns the number of counted elements in every subset of the first partition, indexed by
+     * subset id.
+     */
+    const std::vector<count> &firstSizes() const noexcept { return sizesFirst; }
+
+    /**
+     * Returns the number of counted elements in every subset of the second partition, indexed by
+     * subset id.
+     */
+    const std::vector<count> &secondSizes() const noexcept { return sizesSecond; }
+
+    /**
+     * Returns the number of pairs of elements that are in the same subset in both partitions.
+     */
+    count pairsInEntries() const;
+
+    /**
+     * Returns the number of pairs of elements that are in the same subset of the first partition.
+     */
+    count pairsInFirst() const;
+
+    /**
+     * Returns the number of pairs of elements that are in the same subset of the second partition.
+     */
+    count pairsInSecond() const;
+
+    /**
+     * Calls @a handle(i, C, D, size) in parallel for every entry i.
+     */
+    template <typename F>
+    void parallelForEntries(F handle) const {
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(numberOfEntries()); ++i)
+            handle(static_cast<index>(i), firstSubsets[i], secondSubsets[i], entrySizes[i]);
+    }
+
+private:
+    count numElements = 0;
+    std::vector<index> firstSubsets, secondSubsets;
+    std::vector<count> entrySizes;
+    std::vector<index> entry;
+    std::vector<count> sizesFirst, sizesSecond;
+
+    template <typename ElementFilter>
+    void build(const Partition &zeta, const Partition &eta, count bound, ElementFilter counted);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_CONTINGENCY_TABLE_HPP_
@@ -0,0 +1,127 @@
+/*
+ * DynPLM.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMMUNITY_DYN_PLM_HPP_
+#define NETWORKIT_COMMUNITY_DYN_PLM_HPP_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <networkit/auxiliary/SparseVector.hpp>
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/community/CommunityDetectionAlgorithm.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Dynamic variant of the Parallel Louvain Method (PLM) for undirected graphs. run() computes an
+ * initial partition with PLM. Afterwards, the partition is maintained under batches of graph
+ * updates: starting from the previous partition, only the endpoints of changed edges are
+ * reactivated for the local moving phase (nodes whose neighbors moved are reactivated in turn),
+ * and only the communities that were touched by the update are considered for merging on the
+ * community level. Hence, the cost of an update depends on the volume of the affected nodes and
+ * communities instead of the size of the graph.
+ *
+ * As usual for dynamic algorithms, the graph has to be modified before update() or updateBatch()
+ * is called with the corresponding events. Since Graph::removeNode() removes the edges of a node
+ * without events, a NODE_REMOVAL must be preceded by EDGE_REMOVAL events for all edges of the
+ * node, in the same or an earlier batch, as GraphDifference produces them.
+ */
+class DynPLM final : public CommunityDetectionAlgorithm, public DynAlgorithm {
+
+public:
+    /**
+     * @param[in] G input graph, must be undirected
+     * @param[in] gamma multi-resolution modularity parameter, 1.0 yields standard modularity
+     * @param[in] refine use the refinement of PLM to compute the initial partition
+     * @param[in] maxIter maximum number of rounds of each moving phase
+     */
+    DynPLM(const Graph &G, double gamma = 1.0, bool refine = false, count maxIter = 32);
+
+    /**
+     * Computes the initial partition with PLM.
+     */
+    void run() override;
+
+    /**
+     * Updates the partition after a graph event.
+     *
+     * @param[in] e The event that happened.
+     */
+    void update(GraphEvent e) override;
+
+    /**
+     * Updates the partition after a batch of graph events. Throws std::runtime_error if a node is
+     * removed before the removal of its edges was reported.
+     *
+     * @param[in] batch The events that happened.
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch) override;
+
+    /**
+     * Get string representation.
+     *
+     * @return String representation of this algorithm.
+     */
+    std::string toString() const override;
+
+    /**
+     * Returns the number of node visits of the local moving phase during the last update.
+     */
+    count numberOfVisitedNodes() const {
+        assureFinished();
+        return visitedNodes;
+    }
+
+private:
+    const double gamma;
+    const bool refine;
+    const count maxIter;
+
+    // Volumes of the nodes and communities and twice the total edge weight.
+    std::vector<double> volNode, volCommunity;
+    double totalVolume = 0;
+
+    // Members of every community; u is stored at members[listedIn[u]][position[u]]. listedIn may
+    // lag behind result during the local moving phase.
+    std::vector<std::vector<node>> members;
+    std::vector<index> listedIn, position;
+
+    // Ids of empty communities, reused by newCommunity() such that the number of ids is bounded
+    // by the largest number of communities at any time.
+    std::vector<index> freeCommunities;
+
+    // Scratch data that is reused across updates: per-thread node affinities and community
+    // affinities, both indexed by community.
+    std::vector<Aux::SparseVector<edgeweight>> nodeAffinity;
+    Aux::SparseVector<edgeweight> communityAffinity;
+    std::vector<unsigned char> communityQueued;
+    std::unique_ptr<std::atomic<bool>[]> queued;
+    count queuedSize = 0;
+
+    count visitedNodes = 0;
+
+    void initialize();
+    void addMember(node u, index c);
+    void removeMember(node u);
+    index newCommunity();
+    void releaseIfEmpty(index c);
+
+    // Local moving of the nodes in active, returns the communities that lost or gained nodes.
+    std::vector<index> moveNodes(std::vector<node> active);
+
+    // Merges the communities in affected into neighboring communities while the quality improves.
+    void mergeCommunities(std::vector<index> affected);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_DYN_PLM_HPP_
@@ -0,0 +1,100 @@
+/*
+ * EgoSplitting.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMMUNITY_EGO_SPLITTING_HPP_
+#define NETWORKIT_COMMUNITY_EGO_SPLITTING_HPP_
+
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Cover.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Overlapping community detection with the ego-splitting framework [0]. Every node is split into
+ * personas, one for each community of its ego-net (the subgraph induced by its neighbors, without
+ * the node itself). Every edge {u, v} of the graph becomes an edge between the persona of u whose
+ * local community contains v and the persona of v whose local community contains u. A partition of
+ * this persona graph yields a cover of the original graph, in which every node belongs to the
+ * communities of its personas.
+ *
+ * The ego-nets are built from sorted neighborhoods by intersecting the neighborhood of every node
+ * with the neighborhoods of its neighbors and are clustered in parallel (one ego-net per thread);
+ * the persona graph is built in parallel as well. Both clustering steps use PLP or PLM.
+ *
+ * [0] Ego-Splitting Framework: from Non-Overlapping to Overlapping Clusters
+ * Alessandro Epasto, Silvio Lattanzi and Renato Paes Leme
+ * Proceedings of the 23rd ACM SIGKDD International Conference on Knowledge Discovery and Data
+ * Mining (KDD '17), 2017, 145-154
+ */
+class EgoSplitting final : public Algorithm {
+
+public:
+    enum class Clustering { PLP, PLM };
+
+    /**
+     * @param G The graph, must be undirected and must not contain self-loops.
+     * @param localClustering Algorithm that partitions the ego-nets.
+     * @param globalClustering Algorithm that partitions the persona graph.
+     */
+    EgoSplitting(const Graph &G, Clustering localClustering = Clustering::PLP,
+                 Clustering globalClustering = Clustering::PLM);
+
+    void run() override;
+
+    /**
+     * Returns the cover of the nodes of the graph.
+     */
+    const Cover &getCover() const {
+        assureFinished();
+        return cover;
+    }
+
+    /**
+     * Returns the persona graph.
+     */
+    const Graph &getPersonaGraph() const {
+        assureFinished();
+        return personaGraph;
+    }
+
+    /**
+     * Returns the node of every persona.
+     */
+    const std::vector<node> &getPersonaNodes() const {
+        assureFinished();
+        return personaNode;
+    }
+
+    /**
+     * Returns the number of personas.
+     */
+    count numberOfPersonas() const {
+        assureFinished();
+        return personaNode.size();
+    }
+
+    std::string toString() const override { return "EgoSplitting"; }
+
+    bool isParallel() const override { return true; }
+
+private:
+    const Graph *G;
+    const Clustering localClustering, globalClustering;
+
+    Graph personaGraph;
+    std::vector<node> personaNode;
+    Cover cover;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_EGO_SPLITTING_HPP_
@@ -28,7 +28,7 @@ class PLP final : public CommunityDetectionAlgorithm {
 private:
 
     count updateThreshold = 0;
-    count maxIterations;
+    count maxIterations = none;
     count nIterations = 0; //!< number of iterations in last run
     std::vector<count> timing; //!< running times for each iteration
 
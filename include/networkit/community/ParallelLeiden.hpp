@@ -0,0 +1,95 @@
+/*
+ * ParallelLeiden.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMMUNITY_PARALLEL_LEIDEN_HPP_
+#define NETWORKIT_COMMUNITY_PARALLEL_LEIDEN_HPP_
+
+#include <vector>
+
+#include <networkit/community/CommunityDetectionAlgorithm.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Parallel Leiden algorithm (Traag, Waltman and van Eck, 2019) - a multi-level community detection
+ * algorithm that adds a refinement phase to the Louvain method. After the local moving phase, every
+ * community is split into well-connected subcommunities by merging singletons in random order; the
+ * graph is then aggregated according to these subcommunities, while the communities of the moving
+ * phase serve as the initial partition of the aggregated graph. In contrast to the Louvain method,
+ * the resulting communities are guaranteed to be connected.
+ *
+ * The moving phase only revisits nodes whose neighborhood changed; the refinement phase processes
+ * the communities in parallel. The graph is coarsened with PLM::coarsen.
+ */
+class ParallelLeiden final : public CommunityDetectionAlgorithm {
+
+public:
+    /**
+     * Quality function that is optimized: modularity or the constant Potts model (CPM).
+     */
+    enum Quality { modularity, cpm };
+
+    /**
+     * @param[in] G input graph, must be undirected
+     * @param[in] gamma resolution parameter; for modularity, 1.0 yields standard modularity, for
+     * CPM, communities have a density of at least gamma
+     * @param[in] quality quality function to optimize
+     * @param[in] iterations maximum number of Leiden iterations, every iteration starts from the
+     * result of the previous one
+     * @param[in] randomize process nodes in random order and merge subcommunities randomly during
+     * the refinement; otherwise, merges are greedy
+     * @param[in] maxIter maximum number of rounds of each moving phase
+     */
+    ParallelLeiden(const Graph &G, double gamma = 1.0, Quality quality = modularity,
+                   count iterations = 3, bool randomize = true, count maxIter = 32);
+
+    /**
+     * Detect communities.
+     */
+    void run() override;
+
+    /**
+     * Get string representation.
+     *
+     * @return String representation of this algorithm.
+     */
+    std::string toString() const override;
+
+    /**
+     * Returns the number of Leiden iterations that were performed.
+     */
+    count numberOfIterations() const {
+        assureFinished();
+        return performedIterations;
+    }
+
+private:
+    const double gamma;
+    const Quality quality;
+    const count iterations;
+    const bool randomize;
+    const count maxIter;
+    count performedIterations = 0;
+
+    // Factor of the penalty term: gamma / (2m) for modularity and gamma for CPM.
+    double penalty = 0;
+
+    // Returns true iff at least one node changed its community.
+    bool movePhase(const Graph &H, Partition &zeta, const std::vector<double> &nodeWeight) const;
+
+    Partition refinePhase(const Graph &H, const Partition &zeta,
+                          const std::vector<double> &nodeWeight) const;
+
+    // Performs one multi-level Leiden pass starting from zeta; returns true iff zeta changed.
+    bool leidenPass(Partition &zeta) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_PARALLEL_LEIDEN_HPP_
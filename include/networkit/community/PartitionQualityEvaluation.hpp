@@ -0,0 +1,142 @@
+/*
+ * PartitionQualityEvaluation.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMMUNITY_PARTITION_QUALITY_EVALUATION_HPP_
+#define NETWORKIT_COMMUNITY_PARTITION_QUALITY_EVALUATION_HPP_
+
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Evaluates several quality measures of a partition at once. All measures are derived from
+ * per-cluster statistics (size, volume, internal and cut edge weight, number of internal edges and
+ * maximum internal degree) that are gathered in a single parallel sweep over the edges with
+ * thread-local accumulators of size zeta.upperBound(), instead of one full scan of the graph per
+ * measure.
+ *
+ * The global values agree with Modularity, Coverage, EdgeCut, IntrapartitionDensity and Conductance
+ * (for bipartitions); the cluster values agree with IntrapartitionDensity, PartitionHubDominance
+ * and PartitionFragmentation. Fragmentation additionally requires the connected components of the
+ * graph, which are only computed if it is selected. Unassigned nodes are ignored.
+ */
+class PartitionQualityEvaluation final : public Algorithm {
+
+public:
+    enum Measure {
+        MODULARITY,
+        COVERAGE,
+        EDGE_CUT,
+        CONDUCTANCE,
+        INTRAPARTITION_DENSITY,
+        HUB_DOMINANCE,
+        FRAGMENTATION
+    };
+
+    /**
+     * Evaluates all measures.
+     *
+     * @param G The graph, must be undirected.
+     * @param zeta The partition that shall be evaluated.
+     */
+    PartitionQualityEvaluation(const Graph &G, const Partition &zeta);
+
+    /**
+     * Evaluates the given measures only.
+     *
+     * @param G The graph, must be undirected.
+     * @param zeta The partition that shall be evaluated.
+     * @param measures The measures that shall be evaluated.
+     */
+    PartitionQualityEvaluation(const Graph &G, const Partition &zeta,
+                               const std::vector<Measure> &measures);
+
+    void run() override;
+
+    /**
+     * Returns the global value of measure @a m:
+     * - MODULARITY, COVERAGE, EDGE_CUT: as computed by the respective QualityMeasure,
+     * - CONDUCTANCE: the maximum conductance of a cluster, i.e., the conductance of a bipartition,
+     * - INTRAPARTITION_DENSITY: the number of internal edges divided by the number of possible
+     *   internal edges of all clusters, or 1 if all clusters are singletons,
+     * - HUB_DOMINANCE, FRAGMENTATION: the unweighted average over all clusters.
+     * If the partition has no (nonempty) clusters, CONDUCTANCE, INTRAPARTITION_DENSITY,
+     * HUB_DOMINANCE and FRAGMENTATION are 0.
+     */
+    double getValue(Measure m) const;
+
+    /**
+     * Returns the value of measure @a m for every cluster id; the entries of empty clusters are 0.
+     * For MODULARITY and COVERAGE, these are the contributions of the clusters to the global value;
+     * for EDGE_CUT, the weight of the edges that leave the cluster.
+     */
+    const std::vector<double> &getClusterValues(Measure m) const;
+
+    /**
+     * Returns the number of nodes of every cluster id.
+     */
+    const std::vector<count> &getClusterSizes() const {
+        assureFinished();
+        return size;
+    }
+
+    /**
+     * Returns the volume (weighted degree, self-loops counted twice) of every cluster id.
+     */
+    const std::vector<double> &getClusterVolumes() const {
+        assureFinished();
+        return volume;
+    }
+
+    /**
+     * Returns the total weight of the internal edges of every cluster id.
+     */
+    const std::vector<double> &getInternalWeights() const {
+        assureFinished();
+        return internalWeight;
+    }
+
+    /**
+     * Returns the number of nonempty clusters.
+     */
+    count numberOfClusters() const {
+        assureFinished();
+        return numClusters;
+    }
+
+private:
+    static constexpr count numMeasures = 7;
+
+    const Graph *G;
+    const Partition *zeta;
+    std::vector<bool> selected;
+
+    // Statistics indexed by cluster id.
+    std::vector<count> size, internalEdges, maxInternalDegree;
+    std::vector<double> volume, internalWeight, cutWeight;
+    count numClusters = 0;
+
+    // Weight of the edges between two different clusters.
+    double interClusterWeight = 0;
+
+    std::vector<std::vector<double>> clusterValues;
+    std::vector<double> globalValues;
+
+    void sweep();
+    void computeFragmentation();
+    void checkMeasure(Measure m) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_PARTITION_QUALITY_EVALUATION_HPP_
@@ -0,0 +1,131 @@
+/*
+ * StreamingClustering.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMMUNITY_STREAMING_CLUSTERING_HPP_
+#define NETWORKIT_COMMUNITY_STREAMING_CLUSTERING_HPP_
+
+#include <string>
+#include <vector>
+
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/dynamics/GraphEventHandler.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * One-pass clustering of an edge stream (SCoDA [0]). The graph itself is never stored: the state
+ * consists of the degree and the community of every node and the volume of every community, so
+ * it is linear in the number of nodes and independent of the number of edges.
+ *
+ * Every node starts in its own community. When an edge {u, v} arrives, the degrees of u and v and
+ * the volumes of their communities grow by the weight of the edge. If both communities have a
+ * volume of at most maxVolume, the endpoint in the community with the smaller volume moves to the
+ * community of the other endpoint. Edges that arrive early tend to be intra-community edges, so
+ * the communities grow along the dense parts of the graph.
+ *
+ * The edges can be fed one by one, as GraphEvents (e.g. by registering the clusterer with a
+ * GraphEventProxy) or directly from an edge list file that is read line by line. The resulting
+ * partition can be refined with PLM if the graph fits into memory, see refine().
+ *
+ * [0] A Streaming Algorithm for Graph Clustering
+ * Alexandre Hollocou, Julien Maudet, Thomas Bonald and Marc Lelarge
+ * NIPS 2017 Workshop on Advances in Modeling and Learning Interactions from Complex Data
+ */
+class StreamingClustering final : public GraphEventHandler {
+
+public:
+    /**
+     * @param maxVolume Communities whose volume (sum of the weighted degrees of their members in
+     * the stream seen so far) exceeds this threshold neither gain nor lose nodes.
+     */
+    explicit StreamingClustering(edgeweight maxVolume);
+
+    /**
+     * Processes the edge {u, v} with weight @a w. Node ids that have not been seen before are
+     * added on the fly.
+     */
+    void addEdge(node u, node v, edgeweight w = 1.0);
+
+    /**
+     * Processes a single graph event, see the GraphEventHandler methods. EDGE_WEIGHT_UPDATE events
+     * are not supported since they lack the old weight of the edge.
+     */
+    void update(const GraphEvent &event);
+
+    /**
+     * Processes a sequence of graph events in order.
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch);
+
+    /**
+     * Processes all edges of an edge list file. Every line contains two node ids and optionally
+     * an edge weight; the file is read line by line and never kept in memory.
+     *
+     * @param path Path of the edge list file.
+     * @param separator Character that separates the columns (in addition to spaces).
+     * @param firstNode The id of the first node in the file.
+     * @param commentPrefix Lines that start with this prefix are skipped.
+     */
+    void readEdgeList(const std::string &path, char separator = '\t', node firstNode = 0,
+                      const std::string &commentPrefix = "#");
+
+    /**
+     * Returns the partition of the nodes seen so far; its size is upperNodeIdBound().
+     */
+    Partition getPartition() const;
+
+    /**
+     * Refines the current partition with PLM: the graph @a G is coarsened according to the
+     * partition, the coarse graph is clustered with PLM and the result is projected back to @a G.
+     * Nodes of @a G that have not been seen in the stream start as singletons.
+     *
+     * @param G The graph of the stream, must be undirected.
+     * @return A partition of @a G.
+     */
+    Partition refine(const Graph &G) const;
+
+    /**
+     * Returns an upper bound for the node ids seen so far.
+     */
+    count upperNodeIdBound() const noexcept { return community.size(); }
+
+    /**
+     * Returns the number of edges processed so far.
+     */
+    count numberOfEdges() const noexcept { return numEdges; }
+
+    void onNodeAddition(node u) override;
+    void onNodeRemoval(node u) override;
+    void onNodeRestoration(node u) override;
+    void onEdgeAddition(node u, node v, edgeweight w = 1.0) override;
+    void onEdgeRemoval(node u, node v, edgeweight w = 1.0) override;
+    void onWeightUpdate(node u, node v, edgeweight wOld, edgeweight wNew) override;
+    void onWeightIncrement(node u, node v, edgeweight wOld, edgeweight delta) override;
+    void onTimeStep() override;
+
+private:
+    const edgeweight maxVolume;
+    count numEdges = 0;
+
+    // Indexed by node; the ids of the communities are node ids as well.
+    std::vector<edgeweight> degree;
+    std::vector<index> community;
+    std::vector<edgeweight> volume;
+
+    void ensureNode(node u);
+
+    // Changes the degrees and community volumes of u and v without moving nodes.
+    void changeWeight(node u, node v, edgeweight delta);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_STREAMING_CLUSTERING_HPP_
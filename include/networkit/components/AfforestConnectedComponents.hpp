@@ -0,0 +1,58 @@
+/*
+ * AfforestConnectedComponents.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMPONENTS_AFFOREST_CONNECTED_COMPONENTS_HPP_
+#define NETWORKIT_COMPONENTS_AFFOREST_CONNECTED_COMPONENTS_HPP_
+
+#include <networkit/components/ComponentDecomposition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Computes the connected components of an undirected graph in parallel with the Afforest
+ * algorithm [0]. The edges are merged into a ConcurrentUnionFind, so the running time does not
+ * depend on the diameter of the graph.
+ *
+ * First, only the first few edges of every node are linked (neighbor sampling), which usually
+ * connects most of the largest component. The label that is most frequent among a sample of nodes
+ * is then assumed to be the largest component, and the remaining edges of its nodes are skipped;
+ * the remaining edges of all other nodes are linked as usual.
+ *
+ * The components are numbered in the order of their smallest node id, i.e., the result is the
+ * same as the one of ConnectedComponents.
+ *
+ * [0] Afforest: A Fast Concurrent Connected Components Algorithm
+ * Michael Sutton, Tal Ben-Nun and Amnon Barak
+ * IEEE International Parallel and Distributed Processing Symposium (IPDPS), 2018, 547-556
+ */
+class AfforestConnectedComponents final : public ComponentDecomposition {
+
+public:
+    /**
+     * @param G The graph, must be undirected.
+     * @param neighborRounds Number of edges per node that are linked in the sampling phase.
+     * @param sampleSize Number of nodes that are sampled to find the largest component.
+     */
+    AfforestConnectedComponents(const Graph &G, count neighborRounds = 2,
+                                count sampleSize = 1024);
+
+    void run() override;
+
+    bool isParallel() const override { return true; }
+
+    std::string toString() const override { return "AfforestConnectedComponents"; }
+
+private:
+    const count neighborRounds;
+    const count sampleSize;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMPONENTS_AFFOREST_CONNECTED_COMPONENTS_HPP_
@@ -0,0 +1,145 @@
+/*
+ * DynHDTConnectedComponents.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMPONENTS_DYN_HDT_CONNECTED_COMPONENTS_HPP_
+#define NETWORKIT_COMPONENTS_DYN_HDT_CONNECTED_COMPONENTS_HPP_
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/EulerTourForest.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Maintains the connected components of an undirected graph under edge insertions and deletions
+ * with the algorithm of Holm, de Lichtenberg and Thorup [0], in O(log^2 n) amortized time per
+ * update and O(log n) time per query.
+ *
+ * Every edge has a level; the spanning forest F_i of the edges of level at least i is stored as
+ * an EulerTourForest, and the trees of F_i have at most n / 2^i nodes. When a tree edge is
+ * deleted, the non-tree edges of the smaller tree are searched for a replacement, from the
+ * highest level downwards; edges that do not reconnect the trees are moved one level up, which
+ * pays for the search.
+ *
+ * updateBatch() processes runs of insertions and deletions: for insertions, the trees of the
+ * endpoints are looked up in parallel and the edges that become tree edges are selected by a
+ * spanning forest of the trees; for deletions, all non-tree edges are removed before the tree
+ * edges, so that no deleted edge is chosen as a replacement.
+ *
+ * Components are identified by their smallest node.
+ *
+ * [0] Poly-logarithmic deterministic fully-dynamic algorithms for connectivity, minimum spanning
+ * tree, 2-edge, and biconnectivity
+ * Jacob Holm, Kristian de Lichtenberg and Mikkel Thorup
+ * Journal of the ACM 48(4), 2001, 723-760
+ */
+class DynHDTConnectedComponents final : public Algorithm, public DynAlgorithm {
+
+public:
+    /**
+     * @param G An undirected graph.
+     */
+    DynHDTConnectedComponents(const Graph &G);
+
+    /**
+     * Computes the components of the graph given in the constructor.
+     */
+    void run() override;
+
+    /**
+     * Updates the components after an edge insertion or deletion.
+     */
+    void update(GraphEvent e) override;
+
+    /**
+     * Updates the components after a batch of edge insertions and deletions.
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch) override;
+
+    bool isParallel() const override { return true; }
+
+    std::string toString() const override { return "DynHDTConnectedComponents"; }
+
+    /**
+     * Returns whether @a u and @a v are in the same component.
+     */
+    bool connected(node u, node v) const {
+        assureFinished();
+        return forests.front().connected(u, v);
+    }
+
+    /**
+     * Returns the number of connected components.
+     */
+    count numberOfComponents() const {
+        assureFinished();
+        return G->numberOfNodes() - numTreeEdges;
+    }
+
+    /**
+     * Returns the component of @a u, i.e., its smallest node.
+     */
+    index componentOfNode(node u) const {
+        assureFinished();
+        return forests.front().smallestNode(u);
+    }
+
+    /**
+     * Returns the number of nodes in the component of @a u.
+     */
+    count componentSize(node u) const {
+        assureFinished();
+        return forests.front().treeSize(u);
+    }
+
+    /**
+     * Returns the map from component to size.
+     */
+    std::map<index, count> getComponentSizes() const;
+
+    /**
+     * Returns the components in the order of their smallest node.
+     */
+    std::vector<std::vector<node>> getComponents() const;
+
+private:
+    struct EdgeInfo {
+        count level = 0;
+        count multiplicity = 1;
+        bool tree = false;
+        // Positions of the non-tree edge in the lists of its smaller and of its larger endpoint.
+        index position[2];
+    };
+
+    const Graph *G;
+    std::vector<EulerTourForest> forests;
+    std::unordered_map<Edge, EdgeInfo, EdgeHash> edges;
+    // Non-tree neighbors of every node per level.
+    std::vector<std::vector<std::vector<node>>> nonTree;
+    count numTreeEdges;
+
+    void addNodes();
+    void ensureLevel(count level);
+    void insertEdges(const std::vector<Edge> &batch);
+    void removeEdges(const std::vector<Edge> &batch);
+    void addTreeEdge(node u, node v, count level);
+    void addNonTreeEdge(node u, node v, EdgeInfo &info, count level);
+    void removeNonTreeEdge(node u, node v, EdgeInfo &info);
+    void replace(node u, node v, count level);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMPONENTS_DYN_HDT_CONNECTED_COMPONENTS_HPP_
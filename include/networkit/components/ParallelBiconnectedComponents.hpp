@@ -0,0 +1,133 @@
+/*
+ * ParallelBiconnectedComponents.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMPONENTS_PARALLEL_BICONNECTED_COMPONENTS_HPP_
+#define NETWORKIT_COMPONENTS_PARALLEL_BICONNECTED_COMPONENTS_HPP_
+
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Computes the biconnected components, the articulation points and the bridges of an undirected
+ * graph in parallel, following the algorithm of Tarjan and Vishkin [0].
+ *
+ * A spanning forest is computed by parallel BFS, and the preorder number and subtree size of
+ * every node are computed level by level. low(v) and high(v) are the smallest and the largest
+ * preorder number that is adjacent to the subtree of v. The tree edges are then merged into
+ * biconnected components with a ConcurrentUnionFind: two tree edges are in the same component if
+ * a non-tree edge connects their unrelated lower endpoints, or if they are consecutive and the
+ * subtree of the lower edge has an edge that leaves the subtree of the upper one.
+ *
+ * The results are stored in flat arrays. The components are numbered in the order of their
+ * smallest node that is not the topmost one; isolated nodes are not in any component.
+ *
+ * [0] An Efficient Parallel Biconnectivity Algorithm
+ * Robert E. Tarjan and Uzi Vishkin
+ * SIAM Journal on Computing 14(4), 1985, 862-874
+ */
+class ParallelBiconnectedComponents final : public Algorithm {
+
+public:
+    /**
+     * @param G An undirected graph.
+     */
+    ParallelBiconnectedComponents(const Graph &G);
+
+    void run() override;
+
+    bool isParallel() const override { return true; }
+
+    std::string toString() const override { return "ParallelBiconnectedComponents"; }
+
+    /**
+     * Returns the number of biconnected components.
+     */
+    count numberOfComponents() const {
+        assureFinished();
+        return offsets.size() - 1;
+    }
+
+    /**
+     * Returns the number of nodes of every component.
+     */
+    std::vector<count> getComponentSizes() const;
+
+    /**
+     * Returns the nodes of every component, in increasing order.
+     */
+    std::vector<std::vector<node>> getComponents() const;
+
+    /**
+     * Returns the offsets of the components in getComponentMembers(): the nodes of component i
+     * are at the positions [offsets[i], offsets[i + 1]).
+     */
+    const std::vector<index> &getComponentOffsets() const {
+        assureFinished();
+        return offsets;
+    }
+
+    /**
+     * Returns the nodes of all components, see getComponentOffsets().
+     */
+    const std::vector<node> &getComponentMembers() const {
+        assureFinished();
+        return members;
+    }
+
+    /**
+     * Returns the components that contain node @a u, in increasing order.
+     */
+    std::vector<index> getComponentsOfNode(node u) const;
+
+    /**
+     * Returns whether the removal of @a u increases the number of connected components.
+     */
+    bool isArticulationPoint(node u) const {
+        assureFinished();
+        return articulation[u];
+    }
+
+    /**
+     * Returns all articulation points in increasing order.
+     */
+    std::vector<node> getArticulationPoints() const;
+
+    /**
+     * Returns all edges whose removal increases the number of connected components, with u < v
+     * and sorted.
+     */
+    const std::vector<Edge> &getBridges() const {
+        assureFinished();
+        return bridges;
+    }
+
+private:
+    const Graph *G;
+
+    // Spanning forest; the children of u are at [childOffsets[u], childOffsets[u + 1]).
+    std::vector<node> parent;
+    std::vector<index> childOffsets;
+    std::vector<node> children;
+
+    // Component of the tree edge (parent[v], v), none for roots.
+    std::vector<index> edgeComponent;
+
+    std::vector<index> offsets;
+    std::vector<node> members;
+    std::vector<unsigned char> articulation;
+    std::vector<Edge> bridges;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMPONENTS_PARALLEL_BICONNECTED_COMPONENTS_HPP_
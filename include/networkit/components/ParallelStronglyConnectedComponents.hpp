@@ -0,0 +1,59 @@
+/*
+ * ParallelStronglyConnectedComponents.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_COMPONENTS_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP_
+#define NETWORKIT_COMPONENTS_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP_
+
+#include <networkit/components/ComponentDecomposition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Computes the strongly connected components of a directed graph in parallel, following the
+ * Multistep method [0]:
+ *
+ * 1. Trimming: nodes without incoming or outgoing edges to unfinished nodes are components of
+ *    their own (trim-1), and so are pairs of nodes that are each other's only in- or
+ *    out-neighbors (trim-2).
+ * 2. Forward-backward search: the nodes that are reachable both from and to a pivot of high
+ *    degree form the component of the pivot, which is most likely the largest one. Both searches
+ *    are level-synchronous parallel BFS.
+ * 3. Coloring: every remaining node receives the largest id of the nodes that reach it. The
+ *    nodes with their own id as color are roots, and the nodes of the same color that reach a
+ *    root form its component. This is repeated until all nodes are assigned.
+ *
+ * Finally, every component is relabeled by its smallest node, so that the components are
+ * numbered in the order of their smallest node id.
+ *
+ * [0] BFS and Coloring-Based Parallel Algorithms for Strongly Connected Components and Related
+ * Problems
+ * George M. Slota, Sivasankaran Rajamanickam and Kamesh Madduri
+ * IEEE International Parallel and Distributed Processing Symposium (IPDPS), 2014, 550-559
+ */
+class ParallelStronglyConnectedComponents final : public ComponentDecomposition {
+
+public:
+    /**
+     * @param G A directed graph.
+     */
+    ParallelStronglyConnectedComponents(const Graph &G);
+
+    /**
+     * Runs the algorithm.
+     */
+    void run() override;
+
+    bool isParallel() const override { return true; }
+
+    std::string toString() const override { return "ParallelStronglyConnectedComponents"; }
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMPONENTS_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP_
@@ -43,6 +43,10 @@ public:
   * Updates the pairwise distances after a batch of edge insertions on the graph.
   * Notice: it works only with edge insertions.
   *
+  * The sources whose distances are shortened by the batch are found in parallel for all
+  * inserted edges; then the distances of every affected source are repaired in parallel,
+  * starting from the inserted edges that shorten them.
+  *
   * @param batch The batch of edge insertions.
   */
   void updateBatch(const std::vector<GraphEvent>& batch) override;
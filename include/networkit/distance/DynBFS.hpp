@@ -16,6 +16,10 @@ namespace NetworKit {
 /**
  * @ingroup distance
  * Dynamic breadth-first search.
+ *
+ * Updates are processed level by level: all affected nodes at the same distance from the source
+ * are repaired in parallel, and the affected nodes of the next level are collected in per-thread
+ * buffers.
  */
 class DynBFS final : public DynSSSP {
 
@@ -42,9 +46,9 @@ public:
     bigfloat getNumberOfPaths(node t) const;
 
 private:
-    enum Color {WHITE, BLACK, GRAY};
-    std::vector<Color> color;
-    count maxDistance;
+    // Level in which a node was last put into the frontier, to remove duplicates.
+    std::vector<count> stamp;
+    count round = 0;
 
 };
 
@@ -15,6 +15,10 @@ namespace NetworKit {
 /**
  * @ingroup distance
  * Dynamic Dijkstra.
+ *
+ * In every step of an update, all queued nodes whose distance is smaller than the smallest queued
+ * distance plus the smallest edge weight are final; they are repaired in parallel, and the
+ * distances they propose to their neighbors are collected in per-thread buffers.
  */
 class DynDijkstra final : public DynSSSP {
 
@@ -40,8 +44,10 @@ public:
 
 
 private:
-    enum Color {WHITE, BLACK};
+    enum Color {WHITE, GRAY, BLACK};
     std::vector<Color> color;
+    // smallest weight of all edges of the graph
+    edgeweight minWeight;
 };
 
 
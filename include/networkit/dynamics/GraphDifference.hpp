@@ -1,6 +1,8 @@
 #ifndef NETWORKIT_DYNAMICS_GRAPH_DIFFERENCE_HPP_
 #define NETWORKIT_DYNAMICS_GRAPH_DIFFERENCE_HPP_
 
+#include <vector>
+
 #include <networkit/base/Algorithm.hpp>
 #include <networkit/dynamics/GraphEvent.hpp>
 #include <networkit/graph/Graph.hpp>
@@ -16,8 +18,13 @@ namespace NetworKit {
  * Both graphs need to have the same node set, directed graphs are not
  * supported currently.
  *
- * Note that edge weight differences are not detected but edge
- * addition events set the correct edge weight.
+ * Edge weight differences are reported as edge weight updates.
+ *
+ * The difference is computed in parallel: the nodes are split into
+ * chunks, and for every node the sorted neighborhoods in both graphs
+ * are merged. The events of every chunk are collected separately and
+ * concatenated in the order of the chunks, so the result does not
+ * depend on the number of threads.
  */
 class GraphDifference final : public Algorithm {
 public:
@@ -41,6 +48,13 @@ public:
      */
     std::vector<GraphEvent> getEdits() const;
 
+    /**
+     * Get the required edits without copying them.
+     *
+     * @return Chunks of graph events; their concatenation equals getEdits().
+     */
+    const std::vector<std::vector<GraphEvent>> &getEditChunks() const;
+
     /**
      * Get the required number of edits.
      *
@@ -94,7 +108,7 @@ public:
     count getNumberOfEdgeWeightUpdates() const;
 private:
     const Graph *G1, *G2;
-    std::vector<GraphEvent> edits;
+    std::vector<std::vector<GraphEvent>> editChunks;
     count numEdits;
     count numNodeAdditions;
     count numNodeRemovals;
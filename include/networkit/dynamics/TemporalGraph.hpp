@@ -0,0 +1,179 @@
+/*
+ * TemporalGraph.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_DYNAMICS_TEMPORAL_GRAPH_HPP_
+#define NETWORKIT_DYNAMICS_TEMPORAL_GRAPH_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup dynamics
+ * Sliding-window graph of timestamped edges. Edges are added in order of their timestamps, and an
+ * edge with timestamp t expires once the current time reaches t + windowLength, i.e., the graph
+ * consists of the edges with timestamps in (now - windowLength, now].
+ *
+ * The edges are stored column-wise in order of time, so a time range of edges is a contiguous
+ * range of every column; expired edges are dropped from the front. A Window gives access to the
+ * edges of a time range without copying them.
+ *
+ * Every change of the graph is also recorded as GraphEvents, which can be applied to a Graph, e.g.,
+ * with GraphUpdater or a DynAlgorithm, to maintain the graph of the current window incrementally.
+ * Several edges between the same nodes form one edge of this graph: the first one adds the edge
+ * and the last one that expires removes it. In weighted graphs, the weight of the edge is the sum
+ * of the weights of the edges in the window, and the other edges increment or decrement it.
+ */
+class TemporalGraph final {
+
+public:
+    using timestamp = uint64_t;
+
+    /**
+     * View of the edges of a TemporalGraph within a time range. The view is invalidated by the
+     * next modification of the TemporalGraph.
+     */
+    class Window final {
+
+    public:
+        /**
+         * Returns the number of edges in the window.
+         */
+        count numberOfEdges() const noexcept { return end - begin; }
+
+        /**
+         * Calls handle(u, v, w, t) for all edges in the window in order of time, where w is the
+         * weight and t the timestamp of the edge.
+         */
+        template <typename L>
+        void forEdges(L handle) const;
+
+        /**
+         * Calls handle(u, v, w, t) for all edges in the window in parallel.
+         */
+        template <typename L>
+        void parallelForEdges(L handle) const;
+
+        /**
+         * Returns the graph formed by the edges in the window, with the same rules for multiple
+         * edges between the same nodes as the events of the TemporalGraph.
+         */
+        Graph toGraph() const;
+
+    private:
+        friend class TemporalGraph;
+
+        Window(const TemporalGraph &G, index begin, index end) : G(&G), begin(begin), end(end) {}
+
+        const TemporalGraph *G;
+        index begin, end;
+    };
+
+    /**
+     * Creates a graph with @a n nodes and no edges at time 0.
+     *
+     * @param n Number of nodes.
+     * @param windowLength Time after which edges expire, must be positive.
+     * @param weighted Whether the edges are weighted.
+     * @param directed Whether the edges are directed.
+     */
+    TemporalGraph(count n, timestamp windowLength, bool weighted = false, bool directed = false);
+
+    count numberOfNodes() const noexcept { return n; }
+
+    /**
+     * Returns the number of timestamped edges in the current window.
+     */
+    count numberOfEdges() const noexcept { return times.size() - first; }
+
+    bool isWeighted() const noexcept { return weighted; }
+
+    bool isDirected() const noexcept { return directed; }
+
+    timestamp getWindowLength() const noexcept { return windowLength; }
+
+    /**
+     * Returns the current time, i.e., the latest time passed to addEdge() or advanceTo().
+     */
+    timestamp now() const noexcept { return currentTime; }
+
+    /**
+     * Adds a node and returns its id.
+     */
+    node addNode();
+
+    /**
+     * Advances the time to @a t, which must not be before the current time, and adds the edge
+     * (@a u, @a v) with timestamp @a t.
+     */
+    void addEdge(node u, node v, timestamp t, edgeweight w = defaultEdgeWeight);
+
+    /**
+     * Advances the time to @a t, which must not be before the current time; the edges that expire
+     * are removed.
+     */
+    void advanceTo(timestamp t);
+
+    /**
+     * Returns the events since the last call, in the order of the changes.
+     */
+    std::vector<GraphEvent> popEvents();
+
+    /**
+     * Returns the edges of the current window with timestamps in [@a t0, @a t1).
+     */
+    Window window(timestamp t0, timestamp t1) const;
+
+    /**
+     * Returns all edges of the current window.
+     */
+    Window currentWindow() const { return Window(*this, first, times.size()); }
+
+private:
+    count n;
+    timestamp windowLength;
+    bool weighted;
+    bool directed;
+    timestamp currentTime = 0;
+
+    // Columns of the edges in order of time; the edges before first have expired.
+    std::vector<node> sources;
+    std::vector<node> targets;
+    std::vector<edgeweight> weights; // empty if unweighted
+    std::vector<timestamp> times;
+    index first = 0;
+
+    // Number of edges in the window between every pair of nodes.
+    std::unordered_map<Edge, count, EdgeHash, std::equal_to<Edge>> multiplicity;
+    std::vector<GraphEvent> events;
+
+    edgeweight weightOf(index i) const { return weighted ? weights[i] : defaultEdgeWeight; }
+};
+
+template <typename L>
+void TemporalGraph::Window::forEdges(L handle) const {
+    for (index i = begin; i < end; ++i)
+        handle(G->sources[i], G->targets[i], G->weightOf(i), G->times[i]);
+}
+
+template <typename L>
+void TemporalGraph::Window::parallelForEdges(L handle) const {
+#pragma omp parallel for
+    for (omp_index i = static_cast<omp_index>(begin); i < static_cast<omp_index>(end); ++i)
+        handle(G->sources[i], G->targets[i], G->weightOf(i), G->times[i]);
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DYNAMICS_TEMPORAL_GRAPH_HPP_
@@ -0,0 +1,235 @@
+/*
+ * VersionedGraph.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_DYNAMICS_VERSIONED_GRAPH_HPP_
+#define NETWORKIT_DYNAMICS_VERSIONED_GRAPH_HPP_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup dynamics
+ * Dynamic graph with snapshot isolation: a writer applies batches of GraphEvents, and every batch
+ * creates a new immutable version of the graph. Readers take a Snapshot of the current version
+ * and see it unchanged while later batches are applied. Readers never wait for a writer's batch:
+ * the new version is built aside and published by swapping a single pointer. (The atomic
+ * shared_ptr operations may use a short internal lock, depending on the standard library.)
+ *
+ * Versions share their data copy-on-write. The adjacency arrays of the nodes are grouped into
+ * blocks of blockSize nodes, and a batch only copies the array of block pointers and the blocks
+ * and adjacency arrays of the nodes it changes. The data of a version is freed by reference
+ * counting as soon as no snapshot uses it anymore.
+ */
+class VersionedGraph final {
+
+    struct Adjacency {
+        std::vector<node> out;
+        std::vector<edgeweight> outWeights;
+        // Only used for directed graphs.
+        std::vector<node> in;
+        std::vector<edgeweight> inWeights;
+    };
+
+    struct Block {
+        // Adjacency of every node of the block, nullptr if the node does not exist.
+        std::vector<std::shared_ptr<const Adjacency>> nodes;
+    };
+
+    struct Version {
+        index id = 0;
+        bool weighted;
+        bool directed;
+        count numNodes = 0;
+        count numEdges = 0;
+        count upperBound = 0;
+        std::vector<std::shared_ptr<const Block>> blocks;
+    };
+
+    class Batch;
+
+public:
+    static constexpr count blockSize = 256;
+
+    /**
+     * Immutable view of one version of a VersionedGraph. The view stays valid and unchanged as
+     * long as the snapshot exists, independently of later updates.
+     */
+    class Snapshot final {
+
+    public:
+        /**
+         * Returns the version number; the initial graph has version 0, and every batch increases
+         * it by one.
+         */
+        index version() const noexcept { return data->id; }
+
+        bool isWeighted() const noexcept { return data->weighted; }
+
+        bool isDirected() const noexcept { return data->directed; }
+
+        count numberOfNodes() const noexcept { return data->numNodes; }
+
+        count numberOfEdges() const noexcept { return data->numEdges; }
+
+        count upperNodeIdBound() const noexcept { return data->upperBound; }
+
+        bool hasNode(node u) const noexcept { return u < data->upperBound && adjacency(u); }
+
+        /**
+         * Returns the number of out-neighbors of @a u.
+         */
+        count degree(node u) const { return adjacency(u)->out.size(); }
+
+        /**
+         * Returns the number of in-neighbors of @a u.
+         */
+        count degreeIn(node u) const {
+            return data->directed ? adjacency(u)->in.size() : degree(u);
+        }
+
+        bool hasEdge(node u, node v) const;
+
+        /**
+         * Returns the weight of the edge (@a u, @a v), or 0 if there is no such edge.
+         */
+        edgeweight weight(node u, node v) const;
+
+        /**
+         * Calls handle(u) for all nodes.
+         */
+        template <typename L>
+        void forNodes(L handle) const;
+
+        /**
+         * Calls handle(u) for all nodes in parallel.
+         */
+        template <typename L>
+        void parallelForNodes(L handle) const;
+
+        /**
+         * Calls handle(v, w) for all out-neighbors v of @a u, where w is the weight of the edge.
+         */
+        template <typename L>
+        void forNeighborsOf(node u, L handle) const;
+
+        /**
+         * Calls handle(v, w) for all in-neighbors v of @a u, where w is the weight of the edge.
+         */
+        template <typename L>
+        void forInNeighborsOf(node u, L handle) const;
+
+        /**
+         * Calls handle(u, v, w) for all edges; every undirected edge is reported once, with
+         * u >= v.
+         */
+        template <typename L>
+        void forEdges(L handle) const;
+
+        /**
+         * Copies the snapshot into a Graph, e.g., to run algorithms on it.
+         */
+        Graph toGraph() const;
+
+    private:
+        friend class VersionedGraph;
+
+        explicit Snapshot(std::shared_ptr<const Version> data) : data(std::move(data)) {}
+
+        const Adjacency *adjacency(node u) const {
+            return data->blocks[u / blockSize]->nodes[u % blockSize].get();
+        }
+
+        std::shared_ptr<const Version> data;
+    };
+
+    /**
+     * Creates a graph with @a n nodes and no edges.
+     */
+    VersionedGraph(count n = 0, bool weighted = false, bool directed = false);
+
+    /**
+     * Creates a graph with the nodes and edges of @a G.
+     */
+    explicit VersionedGraph(const Graph &G);
+
+    /**
+     * Applies a batch of events, with the semantics of GraphUpdater, and publishes the result as
+     * a new version. If an event cannot be applied, an exception is thrown and no version is
+     * published. Concurrent calls are serialized.
+     */
+    void update(const std::vector<GraphEvent> &batch);
+
+    /**
+     * Returns a snapshot of the current version; can be called concurrently with update().
+     */
+    Snapshot snapshot() const { return Snapshot(std::atomic_load(&current)); }
+
+    /**
+     * Returns the number of the current version.
+     */
+    index currentVersion() const { return std::atomic_load(&current)->id; }
+
+private:
+    std::shared_ptr<const Version> current;
+    // Adjacency of existing nodes without edges, shared by all of them.
+    std::shared_ptr<const Adjacency> emptyAdjacency;
+    std::mutex writeMutex;
+};
+
+template <typename L>
+void VersionedGraph::Snapshot::forNodes(L handle) const {
+    for (node u = 0; u < data->upperBound; ++u)
+        if (adjacency(u))
+            handle(u);
+}
+
+template <typename L>
+void VersionedGraph::Snapshot::parallelForNodes(L handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(data->upperBound); ++u)
+        if (adjacency(u))
+            handle(static_cast<node>(u));
+}
+
+template <typename L>
+void VersionedGraph::Snapshot::forNeighborsOf(node u, L handle) const {
+    const Adjacency &adj = *adjacency(u);
+    for (index i = 0; i < adj.out.size(); ++i)
+        handle(adj.out[i], data->weighted ? adj.outWeights[i] : defaultEdgeWeight);
+}
+
+template <typename L>
+void VersionedGraph::Snapshot::forInNeighborsOf(node u, L handle) const {
+    if (!data->directed) {
+        forNeighborsOf(u, handle);
+        return;
+    }
+    const Adjacency &adj = *adjacency(u);
+    for (index i = 0; i < adj.in.size(); ++i)
+        handle(adj.in[i], data->weighted ? adj.inWeights[i] : defaultEdgeWeight);
+}
+
+template <typename L>
+void VersionedGraph::Snapshot::forEdges(L handle) const {
+    forNodes([&](node u) {
+        forNeighborsOf(u, [&](node v, edgeweight w) {
+            if (data->directed || v <= u)
+                handle(u, v, w);
+        });
+    });
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DYNAMICS_VERSIONED_GRAPH_HPP_
@@ -15,17 +15,14 @@
 namespace NetworKit {
 
 /**
- * A parallel triangle counting implementation based on ideas in [0].
- *
- * This implementation avoids less work but needs therefore also less checks and
- * is (apart from a fast initialization) parallel without any locks. In experiments
- * this implementation seems to be fast both in non-parallel as well as in parallel
- * settings. With only one thread its performance is similar to the sequential
- * ChibaNishizekiTriangleEdgeScore in NetworKit.
+ * A parallel triangle counting implementation. The edges are oriented from lower to higher degree
+ * (see OrientedGraph) and every triangle is listed exactly once by intersecting the out-neighborhoods
+ * of the endpoints of an oriented edge. This needs O(m^1.5) work and O(m) additional memory [0].
  *
  * [0] Triangle Listing Algorithms: Back from the Diversion
- * Mark Ortmann and Ulrik Brandes * 2014 Proceedings of the Sixteenth Workshop on Algorithm
- * Engineering and Experiments (ALENEX). 2014, 1-8
+ * Mark Ortmann and Ulrik Brandes
+ * 2014 Proceedings of the Sixteenth Workshop on Algorithm Engineering and Experiments (ALENEX).
+ * 2014, 1-8
  */
 class TriangleEdgeScore final : public EdgeScore<count> {
 
@@ -0,0 +1,86 @@
+/*
+ * TrussDecomposition.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_EDGESCORES_TRUSS_DECOMPOSITION_HPP_
+#define NETWORKIT_EDGESCORES_TRUSS_DECOMPOSITION_HPP_
+
+#include <vector>
+
+#include <networkit/edgescores/EdgeScore.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup edgescores
+ * Computes the k-truss decomposition of an undirected graph. The k-truss is the maximal subgraph
+ * in which every edge is part of at least k - 2 triangles of the subgraph. The score of an edge
+ * is its trussness, i.e., the largest k such that the edge belongs to the k-truss. Edges that are
+ * not part of any triangle have trussness 2.
+ *
+ * The initial edge supports are computed with TriangleEdgeScore. Afterwards, edges are peeled
+ * level by level in parallel as proposed in [0]: all edges whose support equals the current level
+ * are removed concurrently, the supports of the remaining edges of their triangles are decreased
+ * atomically and edges that drop to the current level are collected in thread-local buckets for
+ * the next sub-level. Triangles are found by intersecting sorted adjacency arrays.
+ *
+ * The scores can be used like any other edge score, e.g., as input of a sparsification
+ * algorithm.
+ *
+ * [0] Kabir, H., Madduri, K. Parallel k-truss decomposition on multicore systems.
+ * IEEE High Performance Extreme Computing Conference (HPEC), 2017.
+ */
+class TrussDecomposition final : public EdgeScore<count> {
+
+public:
+    /**
+     * Creates the truss decomposition for the graph @a G. The graph must be undirected, must
+     * not contain self-loops and its edges must be indexed.
+     *
+     * @param G The graph.
+     */
+    TrussDecomposition(const Graph &G);
+
+    /**
+     * Computes the trussness of every edge.
+     */
+    void run() override;
+
+    /**
+     * Returns the maximum trussness of any edge, i.e., the largest k such that the k-truss is not
+     * empty. Returns 0 for graphs without edges.
+     */
+    count maxTrussness() const;
+
+    /**
+     * Returns all edge ids sorted by increasing trussness. Together with getTrussOffsets() this
+     * describes the complete truss hierarchy: the k-truss consists of a suffix of this order.
+     */
+    const std::vector<edgeid> &getEdgeOrder() const;
+
+    /**
+     * Returns a vector of size maxTrussness() + 2 whose k-th entry is the position in
+     * getEdgeOrder() of the first edge with trussness at least k.
+     */
+    const std::vector<index> &getTrussOffsets() const;
+
+    /**
+     * Returns the ids of all edges of the k-truss, i.e., all edges with trussness at least @a k.
+     *
+     * @param k The order of the truss.
+     */
+    std::vector<edgeid> getEdgesOfTruss(count k) const;
+
+private:
+    count maxTruss;
+    std::vector<edgeid> edgeOrder;
+    std::vector<index> trussOffsets;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_EDGESCORES_TRUSS_DECOMPOSITION_HPP_
@@ -32,7 +32,10 @@ public:
     static double approxAvgLocal(Graph& G, count trials);
 
     /**
-     * This calculates the global clustering coefficient
+     * This calculates the global clustering coefficient. For undirected graphs, the triangles are
+     * listed on the degree-oriented graph (see OrientedGraph) and self-loops are ignored, i.e.,
+     * they are neither part of a triangle nor counted in the degrees. For directed graphs, the
+     * wedges are formed by the out-neighborhoods, as before.
      */
     static double exactGlobal(Graph& G);
     static double approxGlobal(Graph& G, count trials);
@@ -58,6 +58,16 @@ inline bool operator==(const Edge &e1, const Edge &e2) {
     return e1.u == e2.u && e1.v == e2.v;
 }
 
+/**
+ * Hash of edges for unordered containers; unlike std::hash<Edge>, it does not map (u, v) and
+ * (v, u), or (u, v) and (u ^ 1, v ^ 1), to the same value.
+ */
+struct EdgeHash {
+    size_t operator()(const Edge &e) const noexcept {
+        return std::hash<uint64_t>{}(e.u * 0x9e3779b97f4a7c15ULL + e.v);
+    }
+};
+
 inline bool operator<(const WeightedEdge &e1, const WeightedEdge &e2) {
     return e1.weight < e2.weight;
 }
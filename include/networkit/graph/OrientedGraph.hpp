@@ -0,0 +1,172 @@
+/*
+ * OrientedGraph.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_GRAPH_ORIENTED_GRAPH_HPP_
+#define NETWORKIT_GRAPH_ORIENTED_GRAPH_HPP_
+
+#include <vector>
+
+#include <networkit/auxiliary/SortedIntersection.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/graph/SortedAdjacency.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Acyclic orientation of an undirected graph. The nodes are ranked by a total order and every edge
+ * is directed from the endpoint with the lower rank to the endpoint with the higher rank. The
+ * out-neighbors of every node are stored sorted by id.
+ *
+ * With the degree ordering (by degree, ties broken by id), every node has at most O(sqrt(m))
+ * out-neighbors; with the degeneracy ordering (smallest-last ordering of a core decomposition),
+ * every node has at most degeneracy(G) out-neighbors. Hence, intersecting the out-neighborhoods
+ * of both endpoints of every oriented edge lists all triangles exactly once with O(m^1.5) work and
+ * O(m) memory [0].
+ *
+ * The triangle iterators are parallelized over the oriented edges with dynamic scheduling such that
+ * nodes with many out-neighbors are split across threads.
+ *
+ * [0] Triangle Listing Algorithms: Back from the Diversion
+ * Mark Ortmann and Ulrik Brandes
+ * 2014 Proceedings of the Sixteenth Workshop on Algorithm
+ * Engineering and Experiments (ALENEX). 2014, 1-8
+ */
+class OrientedGraph final {
+public:
+    enum class Ordering { DEGREE, DEGENERACY };
+
+    /**
+     * Orients the undirected graph @a G. Self-loops are not part of any triangle and are dropped.
+     *
+     * @param G The graph.
+     * @param ordering The total order of the nodes that determines the orientation.
+     * @param withEdgeIds If true, the ids of the edges are stored as well (requires indexed edges)
+     * such that triangles can be reported together with the ids of their edges.
+     */
+    OrientedGraph(const Graph &G, Ordering ordering = Ordering::DEGREE, bool withEdgeIds = false);
+
+    /**
+     * Returns the rank of @a u in the node ordering.
+     */
+    index rank(node u) const { return ranks[u]; }
+
+    /**
+     * Returns the number of out-neighbors of @a u, i.e., neighbors with higher rank.
+     */
+    count outDegree(node u) const { return out.degree(u); }
+
+    /**
+     * Returns a pointer to the out-neighbors of @a u sorted by id.
+     */
+    const node *outNeighbors(node u) const { return out.neighbors(u); }
+
+    /**
+     * Returns a pointer to the ids of the edges to the out-neighbors of @a u. Only available if
+     * the edge ids were requested at construction.
+     */
+    const edgeid *outEdgeIds(node u) const { return out.edgeIds(u); }
+
+    /**
+     * Returns the maximum out-degree of any node.
+     */
+    count maxOutDegree() const noexcept { return maxOutDeg; }
+
+    /**
+     * Returns true iff the ids of the edges are stored.
+     */
+    bool hasEdgeIds() const noexcept { return out.hasEdgeIds(); }
+
+    /**
+     * Calls @a handle for every triangle of the graph exactly once in parallel.
+     *
+     * @param handle Takes parameters <code>(node u, node v, node w)</code> where
+     * rank(u) < rank(v) < rank(w).
+     */
+    template <typename L>
+    void parallelForTriangles(L handle) const;
+
+    /**
+     * Calls @a handle for every triangle of the graph exactly once in parallel and passes the ids
+     * of its edges. Requires that the edge ids were requested at construction.
+     *
+     * @param handle Takes parameters <code>(node u, node v, node w, edgeid uv, edgeid uw,
+     * edgeid vw)</code> where rank(u) < rank(v) < rank(w).
+     */
+    template <typename L>
+    void parallelForTrianglesWithEdgeIds(L handle) const;
+
+    /**
+     * Returns the total number of triangles of the graph.
+     */
+    count numberOfTriangles() const;
+
+    /**
+     * Returns the number of triangles every node is part of, indexed by node id.
+     */
+    std::vector<count> trianglesPerNode() const;
+
+    /**
+     * Returns the number of triangles every edge is part of, indexed by edge id. Requires that
+     * the edge ids were requested at construction.
+     */
+    std::vector<count> trianglesPerEdge() const;
+
+private:
+    const Graph *G;
+    std::vector<index> ranks;
+    SortedAdjacency out;
+    // Source node of every entry of the adjacency array, for iterating over the oriented edges.
+    std::vector<node> entrySource;
+    count maxOutDeg = 0;
+
+    template <typename L>
+    void parallelForOrientedEdges(L handle) const;
+};
+
+template <typename L>
+void OrientedGraph::parallelForOrientedEdges(L handle) const {
+    const count numEntries = out.numberOfEntries();
+#pragma omp parallel for schedule(dynamic, 256)
+    for (omp_index i = 0; i < static_cast<omp_index>(numEntries); ++i) {
+        const node u = entrySource[i];
+        handle(u, static_cast<index>(i) - out.offset(u));
+    }
+}
+
+template <typename L>
+void OrientedGraph::parallelForTriangles(L handle) const {
+    parallelForOrientedEdges([&](node u, index i) {
+        const node v = out.neighbors(u)[i];
+        const node *outU = out.neighbors(u);
+        Aux::SortedIntersection::forIntersection(
+            outU, out.degree(u), out.neighbors(v), out.degree(v),
+            [&](index iu, index) { handle(u, v, outU[iu]); });
+    });
+}
+
+template <typename L>
+void OrientedGraph::parallelForTrianglesWithEdgeIds(L handle) const {
+    if (!hasEdgeIds())
+        throw std::runtime_error("OrientedGraph was created without edge ids");
+
+    parallelForOrientedEdges([&](node u, index i) {
+        const node v = out.neighbors(u)[i];
+        const node *outU = out.neighbors(u);
+        const edgeid *idsU = out.edgeIds(u), *idsV = out.edgeIds(v);
+        const edgeid uv = idsU[i];
+        Aux::SortedIntersection::forIntersection(
+            outU, out.degree(u), out.neighbors(v), out.degree(v), [&](index iu, index iv) {
+                handle(u, v, outU[iu], uv, idsU[iu], idsV[iv]);
+            });
+    });
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_ORIENTED_GRAPH_HPP_
@@ -0,0 +1,147 @@
+/*
+ * SortedAdjacency.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_GRAPH_SORTED_ADJACENCY_HPP_
+#define NETWORKIT_GRAPH_SORTED_ADJACENCY_HPP_
+
+#include <algorithm>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Read-only copy of the (outgoing) adjacency of a graph in compressed sparse row format. The
+ * neighbors of every node are sorted by increasing id, such that two neighborhoods can be
+ * intersected with the kernels of Aux::SortedIntersection. Optionally, the ids of the
+ * corresponding edges are stored alongside the neighbors.
+ *
+ * The adjacency is a snapshot: later modifications of the graph are not reflected.
+ */
+class SortedAdjacency final {
+public:
+    SortedAdjacency() = default;
+
+    /**
+     * Copies and sorts the complete (outgoing) adjacency of @a G.
+     *
+     * @param G The graph.
+     * @param withEdgeIds If true, the edge ids are stored as well; requires indexed edges.
+     */
+    SortedAdjacency(const Graph &G, bool withEdgeIds = false);
+
+    /**
+     * Copies and sorts the adjacency of @a G, but only keeps the entries (u, v) for which
+     * @a keep(u, v) returns true. This can for instance be used to orient the edges of an
+     * undirected graph.
+     *
+     * @param G The graph.
+     * @param keep Predicate taking the parameters <code>(node u, node v)</code>.
+     * @param withEdgeIds If true, the edge ids are stored as well; requires indexed edges.
+     */
+    template <typename Filter>
+    SortedAdjacency(const Graph &G, Filter keep, bool withEdgeIds = false);
+
+    /**
+     * Returns the number of stored neighbors of @a u.
+     */
+    count degree(node u) const { return offsets[u + 1] - offsets[u]; }
+
+    /**
+     * Returns a pointer to the sorted neighbors of @a u; there are degree(u) of them.
+     */
+    const node *neighbors(node u) const { return adjacency.data() + offsets[u]; }
+
+    /**
+     * Returns a pointer to the ids of the edges to the neighbors of @a u, in the same order as
+     * neighbors(u). Only available if the adjacency was created with edge ids.
+     */
+    const edgeid *edgeIds(node u) const { return ids.data() + offsets[u]; }
+
+    /**
+     * Returns the position of the first neighbor of @a u in the global adjacency array.
+     */
+    index offset(node u) const { return offsets[u]; }
+
+    /**
+     * Returns true iff the edge ids are stored.
+     */
+    bool hasEdgeIds() const noexcept { return withIds; }
+
+    /**
+     * Returns an upper bound for the node ids (as Graph::upperNodeIdBound()).
+     */
+    index upperNodeIdBound() const noexcept { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    /**
+     * Returns the total number of stored entries.
+     */
+    count numberOfEntries() const noexcept { return adjacency.size(); }
+
+private:
+    std::vector<index> offsets;
+    std::vector<node> adjacency;
+    std::vector<edgeid> ids;
+    bool withIds = false;
+};
+
+template <typename Filter>
+SortedAdjacency::SortedAdjacency(const Graph &G, Filter keep, bool withEdgeIds) {
+    if (withEdgeIds && !G.hasEdgeIds())
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+
+    withIds = withEdgeIds;
+    const count z = G.upperNodeIdBound();
+    offsets.assign(z + 1, 0);
+    G.parallelForNodes([&](node u) {
+        count deg = 0;
+        G.forNeighborsOf(u, [&](node v) {
+            if (keep(u, v))
+                ++deg;
+        });
+        offsets[u + 1] = deg;
+    });
+
+    for (index u = 0; u < z; ++u)
+        offsets[u + 1] += offsets[u];
+
+    adjacency.resize(offsets[z]);
+    if (withEdgeIds)
+        ids.resize(offsets[z]);
+
+    G.balancedParallelForNodes([&](node u) {
+        const auto begin = adjacency.begin() + offsets[u];
+        auto pos = begin;
+        if (!withEdgeIds) {
+            G.forNeighborsOf(u, [&](node v) {
+                if (keep(u, v))
+                    *pos++ = v;
+            });
+            std::sort(begin, pos);
+            return;
+        }
+
+        std::vector<std::pair<node, edgeid>> entries;
+        entries.reserve(degree(u));
+        G.forNeighborsOf(u, [&](node, node v, edgeweight, edgeid eid) {
+            if (keep(u, v))
+                entries.emplace_back(v, eid);
+        });
+        std::sort(entries.begin(), entries.end());
+        for (index i = 0; i < entries.size(); ++i) {
+            adjacency[offsets[u] + i] = entries[i].first;
+            ids[offsets[u] + i] = entries[i].second;
+        }
+    });
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_SORTED_ADJACENCY_HPP_
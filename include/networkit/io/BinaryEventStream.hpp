@@ -0,0 +1,177 @@
+/*
+ * BinaryEventStream.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_IO_BINARY_EVENT_STREAM_HPP_
+#define NETWORKIT_IO_BINARY_EVENT_STREAM_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/io/NetworkitBinaryGraph.hpp>
+
+namespace NetworKit {
+namespace nkbes {
+
+/**
+ * Layout of a binary event stream:
+ *
+ *   Header | block 0 | block 1 | ... | IndexEntry 0 | IndexEntry 1 | ...
+ *
+ * Every block stores a contiguous range of events and can be decoded on its own, which allows
+ * seeking and decoding blocks in parallel. An event is stored as one flag byte followed by
+ * - u as zigzag varint of the difference to the last u in the block that is not none,
+ * - v as zigzag varint of the difference to u (or to the last u, if u is none),
+ * - w as zigzag varint, float or double, or not at all if it is defaultEdgeWeight.
+ * Fields that are none are omitted. The index stores the offset of every block, the number of
+ * events and of TIME_STEP events before it.
+ */
+struct Header {
+    char magic[8];
+    uint64_t events;
+    uint64_t timeSteps;
+    uint64_t blocks;
+    uint64_t offsetIndex;
+};
+
+struct IndexEntry {
+    uint64_t offset;
+    uint64_t firstEvent;
+    uint64_t firstTimeStep;
+};
+
+static constexpr char MAGIC[8] = "nkbes01";
+
+static constexpr uint8_t TYPE_MASK = 0x7; // bits 0-2
+static constexpr uint8_t U_NONE_BIT = 0x8; // bit 3
+static constexpr uint8_t V_NONE_BIT = 0x10; // bit 4
+static constexpr uint8_t WGHT_MASK = 0x60; // bits 5-6
+static constexpr uint8_t WGHT_SHIFT = 5;
+
+enum WEIGHT_FORMAT { DEFAULT = 0, SIGNED_VARINT = 1, FLOAT = 2, DOUBLE = 3 };
+
+/// Appends the encoding of @a event to @a out; @a lastU is the last u of the block.
+inline void encodeEvent(const GraphEvent &event, node &lastU, std::vector<uint8_t> &out) {
+    uint8_t buffer[10];
+    auto putVarInt = [&](uint64_t value) {
+        const size_t bytes = nkbg::varIntEncode(value, buffer);
+        out.insert(out.end(), buffer, buffer + bytes);
+    };
+
+    const edgeweight w = event.w;
+    WEIGHT_FORMAT format = DOUBLE;
+    if (w == defaultEdgeWeight)
+        format = DEFAULT;
+    else if (w >= -9007199254740992.0 && w <= 9007199254740992.0
+             && w == static_cast<edgeweight>(static_cast<int64_t>(w)))
+        format = SIGNED_VARINT;
+    else if (w == static_cast<float>(w))
+        format = FLOAT;
+
+    uint8_t flags = static_cast<uint8_t>(event.type) & TYPE_MASK;
+    flags |= static_cast<uint8_t>(format << WGHT_SHIFT);
+    if (event.u == none)
+        flags |= U_NONE_BIT;
+    if (event.v == none)
+        flags |= V_NONE_BIT;
+    out.push_back(flags);
+
+    if (event.u != none) {
+        putVarInt(nkbg::zigzagEncode(static_cast<int64_t>(event.u - lastU)));
+        lastU = event.u;
+    }
+    if (event.v != none)
+        putVarInt(nkbg::zigzagEncode(static_cast<int64_t>(event.v - lastU)));
+
+    switch (format) {
+    case SIGNED_VARINT:
+        putVarInt(nkbg::zigzagEncode(static_cast<int64_t>(w)));
+        break;
+    case FLOAT: {
+        const float f = static_cast<float>(w);
+        std::memcpy(buffer, &f, sizeof(f));
+        out.insert(out.end(), buffer, buffer + sizeof(f));
+        break;
+    }
+    case DOUBLE:
+        std::memcpy(buffer, &w, sizeof(w));
+        out.insert(out.end(), buffer, buffer + sizeof(w));
+        break;
+    default:
+        break;
+    }
+}
+
+/// Decodes the event at @a data and returns the number of bytes consumed, or 0 if the event
+/// does not end before @a end.
+inline size_t decodeEvent(const uint8_t *data, const uint8_t *end, node &lastU,
+                          GraphEvent &event) noexcept {
+    const uint8_t *it = data;
+    uint64_t value;
+    // The first byte of a varint determines its length.
+    auto getVarInt = [&]() {
+        if (it >= end || static_cast<size_t>(end - it) < (*it ? tlx::ffs(*it) : 9u))
+            return false;
+        it += nkbg::varIntDecode(it, value);
+        return true;
+    };
+    auto getBytes = [&](void *target, size_t bytes) {
+        if (static_cast<size_t>(end - it) < bytes)
+            return false;
+        std::memcpy(target, it, bytes);
+        it += bytes;
+        return true;
+    };
+
+    if (it >= end)
+        return 0;
+    const uint8_t flags = *it++;
+    event.type = static_cast<GraphEvent::Type>(flags & TYPE_MASK);
+    event.u = none;
+    event.v = none;
+    event.w = defaultEdgeWeight;
+    if (!(flags & U_NONE_BIT)) {
+        if (!getVarInt())
+            return 0;
+        event.u = lastU + nkbg::zigzagDecode(value);
+        lastU = event.u;
+    }
+    if (!(flags & V_NONE_BIT)) {
+        if (!getVarInt())
+            return 0;
+        event.v = lastU + nkbg::zigzagDecode(value);
+    }
+
+    switch ((flags & WGHT_MASK) >> WGHT_SHIFT) {
+    case SIGNED_VARINT:
+        if (!getVarInt())
+            return 0;
+        event.w = static_cast<edgeweight>(nkbg::zigzagDecode(value));
+        break;
+    case FLOAT: {
+        float f;
+        if (!getBytes(&f, sizeof(f)))
+            return 0;
+        event.w = f;
+        break;
+    }
+    case DOUBLE:
+        if (!getBytes(&event.w, sizeof(event.w)))
+            return 0;
+        break;
+    default:
+        break;
+    }
+    return it - data;
+}
+
+} // namespace nkbes
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_BINARY_EVENT_STREAM_HPP_
@@ -0,0 +1,95 @@
+/*
+ * BinaryEventStreamReader.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_IO_BINARY_EVENT_STREAM_READER_HPP_
+#define NETWORKIT_IO_BINARY_EVENT_STREAM_READER_HPP_
+
+#include <string>
+#include <vector>
+
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/io/BinaryEventStream.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads streams of GraphEvents written by BinaryEventStreamWriter. The file is memory-mapped;
+ * the events can be read all at once, with the blocks decoded in parallel, or as a sequence of
+ * batches starting at an arbitrary event or time step.
+ */
+class BinaryEventStreamReader final {
+
+public:
+    /**
+     * Opens the file at @a path and reads its index.
+     */
+    explicit BinaryEventStreamReader(const std::string &path);
+
+    /**
+     * Returns the number of events in the stream.
+     */
+    count numberOfEvents() const noexcept { return header.events; }
+
+    /**
+     * Returns the number of TIME_STEP events in the stream.
+     */
+    count numberOfTimeSteps() const noexcept { return header.timeSteps; }
+
+    /**
+     * Returns all events of the stream.
+     */
+    std::vector<GraphEvent> read() const;
+
+    /**
+     * Returns whether nextBatch() returns more events.
+     */
+    bool hasNext() const noexcept { return position < header.events; }
+
+    /**
+     * Returns the index of the event that nextBatch() returns first.
+     */
+    index tell() const noexcept { return position; }
+
+    /**
+     * Returns the next at most @a maxEvents events.
+     */
+    std::vector<GraphEvent> nextBatch(count maxEvents);
+
+    /**
+     * Continues reading at event @a event.
+     */
+    void seek(index event);
+
+    /**
+     * Continues reading after the @a t-th TIME_STEP event, or at the beginning if @a t is 0.
+     */
+    void seekTimeStep(count t);
+
+private:
+    MemoryMappedFile file;
+    nkbes::Header header;
+    std::vector<nkbes::IndexEntry> blockIndex;
+
+    // Position of the next event in the stream and in the file, and the decoder state.
+    index position = 0;
+    index block = 0;
+    const uint8_t *cursor = nullptr;
+    node lastU = 0;
+
+    const uint8_t *blockBegin(index b) const;
+    const uint8_t *blockEnd(index b) const;
+    count blockSize(index b) const;
+    void startBlock(index b);
+    GraphEvent decodeNext();
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_BINARY_EVENT_STREAM_READER_HPP_
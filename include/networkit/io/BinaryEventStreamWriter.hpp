@@ -0,0 +1,57 @@
+/*
+ * BinaryEventStreamWriter.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_IO_BINARY_EVENT_STREAM_WRITER_HPP_
+#define NETWORKIT_IO_BINARY_EVENT_STREAM_WRITER_HPP_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <networkit/dynamics/GraphDifference.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes a stream of GraphEvents in a compact binary format, see BinaryEventStream.hpp. Node ids
+ * are delta-encoded as varints, and the events are split into blocks that are encoded in
+ * parallel and indexed for seeking.
+ */
+class BinaryEventStreamWriter final {
+
+public:
+    /**
+     * @param eventsPerBlock Number of events per block; smaller blocks allow faster seeking,
+     * larger ones compress slightly better.
+     */
+    BinaryEventStreamWriter(count eventsPerBlock = 4096);
+
+    /**
+     * Writes @a stream to the file at @a path.
+     */
+    void write(const std::vector<GraphEvent> &stream, const std::string &path);
+
+    /**
+     * Writes the edits of @a difference, which must have been run, to the file at @a path. The
+     * edits are encoded directly from the chunks of @a difference, without concatenating them.
+     */
+    void write(const GraphDifference &difference, const std::string &path);
+
+private:
+    count eventsPerBlock;
+
+    // Writes the concatenation of the arrays given by pointer and length.
+    void writeParts(const std::vector<std::pair<const GraphEvent *, count>> &parts,
+                    const std::string &path);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_BINARY_EVENT_STREAM_WRITER_HPP_
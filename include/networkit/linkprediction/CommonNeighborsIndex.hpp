@@ -27,7 +27,7 @@ class CommonNeighborsIndex final : public LinkPredictor {
    * @return the number of common neighbors of @a u and @a v
    */
   double runImpl(node u, node v) override {
-      return NeighborhoodUtility::getCommonNeighbors(*G, u, v).size();
+      return NeighborhoodUtility::getNumberOfCommonNeighbors(*G, u, v);
   }
 
 public:
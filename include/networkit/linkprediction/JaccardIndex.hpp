@@ -32,7 +32,7 @@ class JaccardIndex final : public LinkPredictor {
       if (unionSize == 0) {
           return 0;
       }
-      return 1.0 * NeighborhoodUtility::getCommonNeighbors(*G, u, v).size() / unionSize;
+      return 1.0 * NeighborhoodUtility::getNumberOfCommonNeighbors(*G, u, v) / unionSize;
   }
 
 public:
@@ -30,7 +30,7 @@ class NeighborhoodDistanceIndex final : public LinkPredictor {
   double runImpl(node u, node v) override {
     count uNeighborhood = G->degree(u);
     count vNeighborhood = G->degree(v);
-    count intersection = NeighborhoodUtility::getCommonNeighbors(*G, u, v).size();
+    count intersection = NeighborhoodUtility::getNumberOfCommonNeighbors(*G, u, v);
     return ((double)intersection) / (sqrt(uNeighborhood * vNeighborhood));
   }
 
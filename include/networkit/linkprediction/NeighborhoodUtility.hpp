@@ -46,6 +46,15 @@ public:
    */
   static std::vector<node> getCommonNeighbors(const Graph& G, node u, node v);
 
+  /**
+   * Returns the number of common neighbors of @a u and @a v without materializing them.
+   * @param G Graph to obtain common neighbors from
+   * @param u First node
+   * @param v Second node
+   * @return the number of common neighbors of @a u and @a v
+   */
+  static count getNumberOfCommonNeighbors(const Graph& G, node u, node v);
+
 };
 
 } // namespace NetworKit
@@ -22,6 +22,7 @@ class ApproximatePageRank final {
     const Graph* G;
     double alpha;
     double eps;
+    count maxSupport;
 
     std::unordered_map<node, std::pair<double, double>> pr_res;
 
@@ -30,8 +31,11 @@ public:
      * @param g Graph for which an APR is computed.
      * @param alpha Loop probability of random walk.
      * @param epsilon Error tolerance.
+     * @param maxSupport The computation stops early once the support of the vector (the nodes
+     *   that received residual mass) reaches this size. By default, the support is not limited.
      */
-    ApproximatePageRank(const Graph& g, double alpha, double epsilon = 1e-12);
+    ApproximatePageRank(const Graph& g, double alpha, double epsilon = 1e-12,
+                        count maxSupport = none);
 
     /**
      * @return Approximate PageRank vector from @a seed with parameters
@@ -33,7 +33,7 @@ public:
      *
      * @param[out]    community as a set of nodes
      */
-    std::set<node> expandSeed(node s);
+    std::set<node> expandSeed(node s) override;
 
 private:
     std::string objective;    // name of objective function
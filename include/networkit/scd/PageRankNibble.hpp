@@ -48,7 +48,7 @@ public:
      * @return Set of nodes that makes up the best community found around node @a seed.
      *   If target conductance or target size are not fulfilled, an empty set is returned.
      */
-    std::set<node> expandSeed(node seed);
+    std::set<node> expandSeed(node seed) override;
 };
 
 } /* namespace NetworKit */
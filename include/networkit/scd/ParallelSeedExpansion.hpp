@@ -0,0 +1,103 @@
+/*
+ * ParallelSeedExpansion.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_SCD_PARALLEL_SEED_EXPANSION_HPP_
+#define NETWORKIT_SCD_PARALLEL_SEED_EXPANSION_HPP_
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/scd/SelectiveCommunityDetector.hpp>
+
+namespace NetworKit {
+
+/**
+ * Expands many seeds with a SelectiveCommunityDetector in parallel. The seeds are distributed
+ * dynamically over the threads, every thread collects the communities of its seeds in its own
+ * buffer, and the communities are finally stored in flat arrays (the members of all communities
+ * and one offset per seed) instead of one set per seed.
+ *
+ * The work per seed can be limited with SelectiveCommunityDetector::setBudget().
+ */
+class ParallelSeedExpansion final : public Algorithm {
+
+public:
+    /**
+     * @param detector The detector that expands the seeds; its expandSeed() is called concurrently.
+     * @param seeds The seeds; duplicates are expanded multiple times.
+     */
+    ParallelSeedExpansion(SelectiveCommunityDetector &detector, std::vector<node> seeds);
+
+    void run() override;
+
+    /**
+     * Returns the number of seeds.
+     */
+    count numberOfSeeds() const noexcept { return seeds.size(); }
+
+    /**
+     * Returns the i-th seed.
+     */
+    node getSeed(index i) const { return seeds[i]; }
+
+    /**
+     * Returns the size of the community of the i-th seed.
+     */
+    count communitySize(index i) const {
+        assureFinished();
+        return offsets[i + 1] - offsets[i];
+    }
+
+    /**
+     * Returns a pointer to the sorted members of the community of the i-th seed; there are
+     * communitySize(i) of them.
+     */
+    const node *community(index i) const {
+        assureFinished();
+        return members.data() + offsets[i];
+    }
+
+    /**
+     * Returns the offsets of the communities in getMembers(); the community of the i-th seed
+     * consists of the entries in [offsets[i], offsets[i + 1]).
+     */
+    const std::vector<index> &getOffsets() const {
+        assureFinished();
+        return offsets;
+    }
+
+    /**
+     * Returns the members of all communities, ordered by seed.
+     */
+    const std::vector<node> &getMembers() const {
+        assureFinished();
+        return members;
+    }
+
+    /**
+     * Returns a mapping from seed node to community (as returned by
+     * SelectiveCommunityDetector::run()).
+     */
+    std::map<node, std::set<node>> getCommunityMap() const;
+
+    bool isParallel() const override { return true; }
+
+    std::string toString() const override { return "ParallelSeedExpansion"; }
+
+private:
+    SelectiveCommunityDetector *detector;
+    std::vector<node> seeds;
+    std::vector<index> offsets;
+    std::vector<node> members;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_SCD_PARALLEL_SEED_EXPANSION_HPP_
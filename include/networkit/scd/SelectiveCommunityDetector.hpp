@@ -32,8 +32,23 @@ public:
      */
     virtual std::map<node, std::set<node>> run(const std::set<node>& seeds) = 0;
 
+    /**
+     * Detect the community of a single seed node. Implementations must allow concurrent calls
+     * for different seeds, see ParallelSeedExpansion.
+     * @return the community (as a set of nodes)
+     */
+    virtual std::set<node> expandSeed(node seed) = 0;
+
+    /**
+     * Limits the work per seed: the expansion of a seed stops early once it has reached
+     * @a maxNodes nodes (the community for GCE, the support of the approximate PageRank vector
+     * for PageRankNibble). By default, the work is not limited.
+     */
+    void setBudget(count maxNodes) { budget = maxNodes; }
+
 protected:
     const Graph* G;
+    count budget = none;
 };
 
 } /* namespace NetworKit */
@@ -0,0 +1,172 @@
+/*
+ * CompactCover.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_STRUCTURES_COMPACT_COVER_HPP_
+#define NETWORKIT_STRUCTURES_COMPACT_COVER_HPP_
+
+#include <algorithm>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/structures/Cover.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Read-only, flat representation of a cover (or a partition, i.e., a cover where every element is
+ * in at most one subset). The memberships are stored twice in compressed sparse row format: for
+ * every subset its members and for every element its subsets, both sorted by increasing id. This
+ * needs two indices per membership instead of a tree node per membership as in Cover, and the
+ * member lists are built in parallel by counting sort.
+ *
+ * If the subset ids are sparse, i.e., their range is much larger than the number of memberships,
+ * only the ids that occur are stored, and the member lists are looked up by binary search.
+ *
+ * The representation is a snapshot: later modifications of the cover are not reflected.
+ */
+class CompactCover final {
+public:
+    CompactCover() = default;
+
+    /**
+     * Creates the member lists of the subsets of @a zeta; unassigned elements are skipped.
+     */
+    explicit CompactCover(const Partition &zeta);
+
+    /**
+     * Creates the member lists of the subsets of @a zeta.
+     */
+    explicit CompactCover(const Cover &zeta);
+
+    /**
+     * Returns the number of elements.
+     */
+    count numberOfElements() const noexcept {
+        return elementOffsets.empty() ? 0 : elementOffsets.size() - 1;
+    }
+
+    /**
+     * Returns an upper bound for the subset ids; it is at least the upper bound of the original
+     * cover.
+     */
+    index upperBound() const noexcept { return upperId; }
+
+    /**
+     * Returns whether arrays indexed by the subset ids below @a bound are small enough compared
+     * to @a entries, the number of elements or memberships, to be allocated.
+     */
+    static bool isDenseIdRange(index bound, count entries) noexcept {
+        return bound <= 4 * entries + 1024;
+    }
+
+    /**
+     * Returns the number of nonempty subsets.
+     */
+    count numberOfSubsets() const noexcept { return nonemptySubsets; }
+
+    /**
+     * Returns the total number of memberships, i.e., the sum of the subset sizes.
+     */
+    count numberOfMemberships() const noexcept { return members.size(); }
+
+    /**
+     * Returns the number of members of subset @a s.
+     */
+    count subsetSize(index s) const {
+        const index i = slot(s);
+        return i == none ? 0 : memberOffsets[i + 1] - memberOffsets[i];
+    }
+
+    /**
+     * Returns a pointer to the sorted members of subset @a s; there are subsetSize(s) of them.
+     */
+    const index *membersOf(index s) const {
+        const index i = slot(s);
+        return members.data() + (i == none ? 0 : memberOffsets[i]);
+    }
+
+    /**
+     * Returns the number of subsets that contain element @a e.
+     */
+    count numberOfSubsetsOf(index e) const { return elementOffsets[e + 1] - elementOffsets[e]; }
+
+    /**
+     * Returns a pointer to the sorted ids of the subsets that contain element @a e; there are
+     * numberOfSubsetsOf(e) of them.
+     */
+    const index *subsetsOf(index e) const { return subsets.data() + elementOffsets[e]; }
+
+    /**
+     * Returns the sizes of all subset ids below upperBound(), including empty subsets; this needs
+     * memory proportional to upperBound() also if the ids are sparse.
+     */
+    std::vector<count> subsetSizes() const;
+
+    /**
+     * Calls @a handle(e) for every member e of subset @a s in increasing order.
+     */
+    template <typename F>
+    void forMembersOf(index s, F handle) const {
+        const index i = slot(s);
+        if (i == none)
+            return;
+        for (index j = memberOffsets[i]; j < memberOffsets[i + 1]; ++j)
+            handle(members[j]);
+    }
+
+    /**
+     * Calls @a handle(s) for every nonempty subset s in increasing order of s.
+     */
+    template <typename F>
+    void forSubsets(F handle) const {
+        for (index i = 0; i + 1 < memberOffsets.size(); ++i)
+            if (memberOffsets[i] < memberOffsets[i + 1])
+                handle(idOf(i));
+    }
+
+    /**
+     * Calls @a handle(s) in parallel for every nonempty subset s.
+     */
+    template <typename F>
+    void parallelForSubsets(F handle) const {
+#pragma omp parallel for schedule(dynamic, 16)
+        for (omp_index i = 0; i < static_cast<omp_index>(memberOffsets.size()) - 1; ++i)
+            if (memberOffsets[i] < memberOffsets[i + 1])
+                handle(idOf(static_cast<index>(i)));
+    }
+
+private:
+    std::vector<index> elementOffsets, subsets;
+    // Member lists per slot; a slot is the subset id itself or, if the ids are sparse, the
+    // position of the id in subsetIds.
+    std::vector<index> memberOffsets, members;
+    // Sorted ids of the nonempty subsets, only used if the ids are sparse.
+    std::vector<index> subsetIds;
+    bool sparseIds = false;
+    index upperId = 0;
+    count nonemptySubsets = 0;
+
+    index slot(index s) const {
+        if (!sparseIds)
+            return s < upperId ? s : none;
+        const auto it = std::lower_bound(subsetIds.begin(), subsetIds.end(), s);
+        return it != subsetIds.end() && *it == s ? static_cast<index>(it - subsetIds.begin())
+                                                 : none;
+    }
+
+    index idOf(index i) const { return sparseIds ? subsetIds[i] : i; }
+
+    // Builds the member lists from the element lists.
+    void buildMemberLists(index upper);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_STRUCTURES_COMPACT_COVER_HPP_
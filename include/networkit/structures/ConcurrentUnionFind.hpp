@@ -0,0 +1,174 @@
+/*
+ * ConcurrentUnionFind.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_STRUCTURES_CONCURRENT_UNION_FIND_HPP_
+#define NETWORKIT_STRUCTURES_CONCURRENT_UNION_FIND_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Union-find data structure that allows concurrent calls of find(), unite() and inSameSet() from
+ * several threads. The parent pointers are atomic: unite() links a root below another root with a
+ * single compare-and-swap and retries if the root has changed in the meantime, and find() shortens
+ * the paths it visits by path splitting.
+ *
+ * Roots are linked by a fixed priority order instead of a rank: by default, the root with the
+ * larger id is linked below the root with the smaller id, so every set is represented by its
+ * smallest element. With randomized linking, the order is given by a random permutation of the
+ * elements, which bounds the expected depth of the trees independently of the order of the
+ * unions.
+ */
+class ConcurrentUnionFind final {
+
+public:
+    /**
+     * Creates @a numElements singleton sets.
+     *
+     * @param numElements The number of elements.
+     * @param randomizedLinking Link the roots by a random order instead of by their ids.
+     */
+    explicit ConcurrentUnionFind(count numElements, bool randomizedLinking = false);
+
+    /**
+     * Assigns every element to a singleton set; must not be called concurrently.
+     */
+    void allToSingletons();
+
+    /**
+     * Returns the number of elements.
+     */
+    count numberOfElements() const noexcept { return n; }
+
+    /**
+     * Returns the representative of the set that contains @a u. When called concurrently with
+     * unite(), the representative may change afterwards.
+     */
+    index find(index u) {
+        while (true) {
+            index p = parent[u].load(std::memory_order_relaxed);
+            const index grandparent = parent[p].load(std::memory_order_relaxed);
+            if (p == grandparent)
+                return p;
+            // Path splitting: let u point to its grandparent and continue with its parent.
+            parent[u].compare_exchange_weak(p, grandparent, std::memory_order_relaxed);
+            u = p;
+        }
+    }
+
+    /**
+     * Merges the sets that contain @a u and @a v.
+     *
+     * @return True if the sets have been merged by this call, false if @a u and @a v were
+     * already in the same set.
+     */
+    bool unite(index u, index v) {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v)
+                return false;
+            if (linksBelow(v, u))
+                std::swap(u, v);
+            index expected = u;
+            if (parent[u].compare_exchange_strong(expected, v))
+                return true;
+        }
+    }
+
+    /**
+     * Returns whether @a u and @a v are in the same set.
+     */
+    bool inSameSet(index u, index v) {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v)
+                return true;
+            // u has been a root when v was found, so the sets have been different then.
+            if (parent[u].load(std::memory_order_relaxed) == u)
+                return false;
+        }
+    }
+
+    /**
+     * Calls unite(pairAt(i).first, pairAt(i).second) in parallel for all i in [0, numPairs).
+     *
+     * @return The number of merges, i.e., by how much the number of sets has decreased.
+     */
+    template <typename F>
+    count parallelUnite(count numPairs, F pairAt);
+
+    /**
+     * Merges the sets of all pairs of @a pairs in parallel.
+     *
+     * @return The number of merges.
+     */
+    count uniteAll(const std::vector<std::pair<index, index>> &pairs) {
+        return parallelUnite(pairs.size(), [&](index i) { return pairs[i]; });
+    }
+
+    /**
+     * Lets every element point to its representative, in parallel. Afterwards, find() takes a
+     * single step until the next call of unite(). Must not be called concurrently with unite().
+     */
+    void compress();
+
+    /**
+     * Converts the sets into a Partition, in parallel; the subset ids are the representatives.
+     */
+    Partition toPartition();
+
+private:
+    count n;
+    std::unique_ptr<std::atomic<index>[]> parent;
+    bool randomizedLinking;
+    uint64_t seed;
+
+    // Returns whether root u is linked below root v.
+    bool linksBelow(index u, index v) const {
+        if (randomizedLinking) {
+            const uint64_t pu = priority(u), pv = priority(v);
+            if (pu != pv)
+                return pu < pv;
+        }
+        return u > v;
+    }
+
+    // A pseudo-random priority of u, see SplitMix64.
+    uint64_t priority(index u) const {
+        uint64_t x = u + seed;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+};
+
+template <typename F>
+count ConcurrentUnionFind::parallelUnite(count numPairs, F pairAt) {
+    count merges = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : merges)
+    for (omp_index i = 0; i < static_cast<omp_index>(numPairs); ++i) {
+        const std::pair<index, index> pair = pairAt(static_cast<index>(i));
+        merges += unite(pair.first, pair.second);
+    }
+    return merges;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_STRUCTURES_CONCURRENT_UNION_FIND_HPP_
@@ -0,0 +1,156 @@
+/*
+ * EulerTourForest.hpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#ifndef NETWORKIT_STRUCTURES_EULER_TOUR_FOREST_HPP_
+#define NETWORKIT_STRUCTURES_EULER_TOUR_FOREST_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Dynamic forest that supports link, cut and connectivity queries in expected O(log n) time.
+ * Every tree is stored as its Euler tour in a treap: each node occurs once, and each tree edge
+ * {u, v} occurs as the two arcs (u, v) and (v, u). Linking and cutting trees splits and
+ * concatenates the tours.
+ *
+ * Nodes and edges can be marked; the treaps keep track of the marked nodes and edges in every
+ * subtree, so that the marked nodes or edges of a tree can be listed in time proportional to
+ * their number times O(log n). Nodes that have never been linked or marked occupy no element.
+ */
+class EulerTourForest final {
+
+public:
+    /**
+     * Creates a forest of singleton trees for the nodes [0, @a numNodes).
+     */
+    explicit EulerTourForest(count numNodes = 0);
+
+    /**
+     * Increases the number of nodes to @a numNodes; the new nodes are singletons.
+     */
+    void addNodes(count numNodes);
+
+    /**
+     * Returns the number of nodes.
+     */
+    count numberOfNodes() const noexcept { return vertex.size(); }
+
+    /**
+     * Returns an id of the tree that contains @a u, which is valid until the forest is modified.
+     */
+    index treeOf(node u) const;
+
+    /**
+     * Returns whether @a u and @a v are in the same tree.
+     */
+    bool connected(node u, node v) const { return u == v || treeOf(u) == treeOf(v); }
+
+    /**
+     * Returns the number of nodes in the tree of @a u.
+     */
+    count treeSize(node u) const;
+
+    /**
+     * Returns the smallest node in the tree of @a u.
+     */
+    node smallestNode(node u) const;
+
+    /**
+     * Returns whether {@a u, @a v} is an edge of the forest.
+     */
+    bool hasEdge(node u, node v) const { return arcs.count(Edge(u, v, true)) > 0; }
+
+    /**
+     * Adds the edge {@a u, @a v}; @a u and @a v must be in different trees.
+     */
+    void link(node u, node v);
+
+    /**
+     * Removes the edge {@a u, @a v}, which must be an edge of the forest.
+     */
+    void cut(node u, node v);
+
+    /**
+     * Sets the mark of node @a u.
+     */
+    void markNode(node u, bool marked);
+
+    /**
+     * Sets the mark of the edge {@a u, @a v}, which must be an edge of the forest.
+     */
+    void markEdge(node u, node v, bool marked);
+
+    /**
+     * Returns the marked nodes of the tree of @a u.
+     */
+    std::vector<node> markedNodes(node u) const;
+
+    /**
+     * Returns the marked edges of the tree of @a u.
+     */
+    std::vector<Edge> markedEdges(node u) const;
+
+private:
+    struct Element {
+        index parent = none, left = none, right = none;
+        uint64_t priority;
+        // Tail of the arc, or the node itself.
+        node from;
+        // Head of the arc, none for nodes.
+        node to;
+        // Number of elements and of nodes in the subtree, and the smallest node in it.
+        count size = 1;
+        count nodes;
+        node minNode;
+        bool marked = false;
+        // Whether the subtree contains a marked node or a marked arc.
+        bool nodeMarks = false;
+        bool arcMarks = false;
+
+        Element(node from, node to, uint64_t priority)
+            : priority(priority), from(from), to(to), nodes(to == none),
+              minNode(to == none ? from : none) {}
+
+        bool isNode() const { return to == none; }
+    };
+
+    std::vector<Element> elements;
+    std::vector<index> freeElements;
+    // Element of every node, none if the node is a singleton without an element.
+    std::vector<index> vertex;
+    // Arcs (u, v) and (v, u) of every edge, with u < v.
+    std::unordered_map<Edge, std::pair<index, index>, EdgeHash> arcs;
+
+    index newElement(node from, node to);
+    void freeElement(index x);
+    index vertexElement(node u);
+
+    index root(index x) const;
+    index position(index x) const;
+    void update(index x);
+    void updatePath(index x);
+    index merge(index a, index b);
+    std::pair<index, index> split(index x, bool xLeft);
+    index reroot(index x);
+
+    template <typename F>
+    void forSubtree(index r, bool arcMarks, F handle) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_STRUCTURES_EULER_TOUR_FOREST_HPP_
@@ -186,8 +186,9 @@ public:
     /**
      * Change subset IDs to be consecutive, starting at 0.
      *
-     * @param useTurbo Default: false. If set to true, a vector instead of a map to assign new ids
-     * which results in a shorter running time but possibly a large space overhead.
+     * @param useTurbo Default: false. If false, the new ids preserve the order of the old ids and
+     * are computed in parallel. If set to true, the new ids are assigned in order of the first
+     * occurrence of the subsets.
      */
     void compact(bool useTurbo = false);
 
@@ -315,6 +316,17 @@ private:
         index s = ++omega;
         return s;
     }
+
+    /**
+     * Returns an upper bound for the assigned subset ids that is at least upperBound().
+     */
+    index subsetIdBound() const;
+
+    /**
+     * Returns the ids and sizes of the nonempty subsets in increasing order of id, computed in
+     * parallel.
+     */
+    std::vector<std::pair<index, count>> subsetIdsAndSizes() const;
 };
 
 template <typename Callback>
@@ -1513,11 +1513,9 @@ cdef class LocalClusteringCoefficient(Centrality):
 	Constructs the LocalClusteringCoefficient class for the given Graph `G`. If the local clustering coefficient values should be normalized,
 	then set `normalized` to True. The graph may not contain self-loops.
 
-	There are two algorithms available. The trivial (parallel) algorithm needs only a small amount of additional memory.
-	The turbo mode adds a (sequential, but fast) pre-processing step using ideas from [0]. This reduces the running time
-	significantly for most graphs. However, the turbo mode needs O(m) additional memory. In practice this should be a bit
-	less than half of the memory that is needed for the graph itself. The turbo mode is particularly effective for graphs
-	with nodes of very high degree and a very skewed degree distribution.
+	The edges are oriented from lower to higher degree and every triangle is listed exactly once using ideas from [0].
+	This needs O(m) additional memory and is particularly effective for graphs with nodes of very high degree and a
+	very skewed degree distribution.
 
 	[0] Triangle Listing Algorithms: Back from the Diversion
 	Mark Ortmann and Ulrik Brandes
@@ -1528,7 +1526,7 @@ cdef class LocalClusteringCoefficient(Centrality):
  	G : networkit.Graph
  		The graph.
 	turbo : bool
-		If the turbo mode shall be activated.
+		Kept for compatibility; has no effect.
 	"""
 
 	def __cinit__(self, Graph G, bool_t turbo = False):
@@ -1536,6 +1534,79 @@ cdef class LocalClusteringCoefficient(Centrality):
 		self._this = new _LocalClusteringCoefficient(G._this, turbo)
 
 
+cdef extern from "<networkit/centrality/ApproxLocalClusteringCoefficient.hpp>":
+
+	cdef cppclass _ApproxLocalClusteringCoefficient "NetworKit::ApproxLocalClusteringCoefficient" (_Centrality):
+		_ApproxLocalClusteringCoefficient(_Graph, double, double, count) except +
+		vector[double] getLowerBounds() except +
+		vector[double] getUpperBounds() except +
+		vector[double] getDegreeClassScores() except +
+		vector[double] getDegreeClassLowerBounds() except +
+		vector[double] getDegreeClassUpperBounds() except +
+		vector[count] getDegreeClassSizes() except +
+		count numberOfSamples() except +
+		bool_t reachedErrorBound() except +
+
+cdef class ApproxLocalClusteringCoefficient(Centrality):
+	"""
+	ApproxLocalClusteringCoefficient(G, epsilon=0.01, delta=0.1, timeLimit=0)
+
+	Approximation of the local clustering coefficients by wedge sampling. For every node, pairs of
+	distinct neighbors are sampled uniformly at random and the fraction of adjacent pairs is
+	reported. The estimates are within an additive error epsilon with probability at least
+	(1 - delta) each; nodes with few wedges are evaluated exactly. Additionally, the average local
+	clustering coefficient of every degree class (degrees in [2^i, 2^(i+1))) is estimated. All
+	estimates come with confidence bounds. The graph may not contain self-loops.
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The graph.
+	epsilon : double, optional
+		Maximum additive error of the per-node estimates.
+	delta : double, optional
+		Probability that an estimate violates its error bound.
+	timeLimit : count, optional
+		Time budget in milliseconds, 0 means no limit.
+	"""
+
+	def __cinit__(self, Graph G, epsilon=0.01, delta=0.1, timeLimit=0):
+		self._G = G
+		self._this = new _ApproxLocalClusteringCoefficient(G._this, epsilon, delta, timeLimit)
+
+	def getLowerBounds(self):
+		""" Returns the lower confidence bounds of the local clustering coefficients. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).getLowerBounds()
+
+	def getUpperBounds(self):
+		""" Returns the upper confidence bounds of the local clustering coefficients. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).getUpperBounds()
+
+	def getDegreeClassScores(self):
+		""" Returns the estimated average local clustering coefficient of every degree class. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).getDegreeClassScores()
+
+	def getDegreeClassLowerBounds(self):
+		""" Returns the lower confidence bounds of the degree class estimates. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).getDegreeClassLowerBounds()
+
+	def getDegreeClassUpperBounds(self):
+		""" Returns the upper confidence bounds of the degree class estimates. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).getDegreeClassUpperBounds()
+
+	def getDegreeClassSizes(self):
+		""" Returns the number of nodes of every degree class. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).getDegreeClassSizes()
+
+	def numberOfSamples(self):
+		""" Returns the total number of wedges that were checked. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).numberOfSamples()
+
+	def reachedErrorBound(self):
+		""" Returns True iff the time limit was not hit before the error bound was reached. """
+		return (<_ApproxLocalClusteringCoefficient*>(self._this)).reachedErrorBound()
+
+
 cdef extern from "<networkit/centrality/Sfigality.hpp>":
 
 	cdef cppclass _Sfigality "NetworKit::Sfigality" (_Centrality):
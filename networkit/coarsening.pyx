@@ -45,6 +45,16 @@ cdef extern from "<networkit/coarsening/ParallelPartitionCoarsening.hpp>":
 
 
 cdef class ParallelPartitionCoarsening(GraphCoarsening):
+	"""Contracts every subset of a partition into a supernode.
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+	zeta : networkit.Partition
+	useGraphBuilder : bool, optional
+		unused, kept for compatibility
+	"""
+
 	def __cinit__(self, Graph G not None, Partition zeta not None, useGraphBuilder = True):
 		self._this = new _ParallelPartitionCoarsening(G._this, zeta._this, useGraphBuilder)
 
@@ -27,6 +27,7 @@ ctypedef index node
 ctypedef double edgeweight
 
 from .base cimport _Algorithm, Algorithm
+from .dynamics cimport _GraphEvent, GraphEvent
 from .graph cimport _Graph, Graph
 from .structures cimport _Partition, Partition, _Cover, Cover
 from .graphio import PartitionReader, PartitionWriter, EdgeListPartitionReader, BinaryPartitionReader, BinaryPartitionWriter, BinaryEdgeListPartitionReader, BinaryEdgeListPartitionWriter
@@ -390,6 +391,239 @@ cdef class PLM(CommunityDetector):
 	def prolong(Graph Gcoarse, Partition zetaCoarse, Graph Gfine, vector[node] nodeToMetaNode):
 		return Partition().setThis(PLM_prolong(Gcoarse._this, zetaCoarse._this, Gfine._this, nodeToMetaNode))
 
+cdef extern from "<networkit/community/DynPLM.hpp>":
+
+	cdef cppclass _DynPLM "NetworKit::DynPLM"(_CommunityDetectionAlgorithm):
+		_DynPLM(_Graph _G, double gamma, bool_t refine, count maxIter) except +
+		void update(_GraphEvent) except +
+		void updateBatch(vector[_GraphEvent]) except +
+		count numberOfVisitedNodes() except +
+
+cdef class DynPLM(CommunityDetector):
+	""" Dynamic Parallel Louvain Method. run() computes an initial partition with PLM; afterwards,
+		the partition is updated after graph events, starting from the previous partition and only
+		reactivating the nodes and communities that are affected by the changes. The graph has to
+		be modified before the corresponding events are passed to update() or updateBatch(). A
+		NODE_REMOVAL must be preceded by EDGE_REMOVAL events for all edges of the node.
+
+		Parameters:
+		-----------
+		G : networkit.Graph
+			A graph.
+		gamma : double
+			Multi-resolution modularity parameter, 1.0 yields standard modularity.
+		refine : bool, optional
+			Use the refinement of PLM to compute the initial partition.
+		maxIter : count
+			Maximum number of rounds of each moving phase.
+	"""
+
+	def __cinit__(self, Graph G not None, gamma=1.0, refine=False, maxIter=32):
+		self._G = G
+		self._this = new _DynPLM(G._this, gamma, refine, maxIter)
+
+	def update(self, event):
+		""" Updates the partition after a graph event.
+
+			Parameters:
+			-----------
+			event : GraphEvent
+				The event that happened.
+		"""
+		(<_DynPLM*>(self._this)).update(_GraphEvent(event.type, event.u, event.v, event.w))
+
+	def updateBatch(self, batch):
+		""" Updates the partition after a batch of graph events.
+
+			Parameters:
+			-----------
+			batch : list of GraphEvent
+				The events that happened.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for event in batch:
+			_batch.push_back(_GraphEvent(event.type, event.u, event.v, event.w))
+		(<_DynPLM*>(self._this)).updateBatch(_batch)
+
+	def numberOfVisitedNodes(self):
+		""" Returns the number of node visits of the local moving phase during the last update.
+
+			Returns:
+			--------
+			count
+				The number of node visits.
+		"""
+		return (<_DynPLM*>(self._this)).numberOfVisitedNodes()
+
+cdef extern from "<networkit/community/StreamingClustering.hpp>":
+
+	cdef cppclass _StreamingClustering "NetworKit::StreamingClustering":
+		_StreamingClustering(edgeweight maxVolume) except +
+		void addEdge(node u, node v, edgeweight w) except +
+		void update(_GraphEvent) except +
+		void updateBatch(vector[_GraphEvent]) except +
+		void readEdgeList(string path, char separator, node firstNode, string commentPrefix) except +
+		_Partition getPartition() except +
+		_Partition refine(_Graph G) except +
+		count upperNodeIdBound()
+		count numberOfEdges()
+
+cdef class StreamingClustering:
+	""" One-pass clustering of an edge stream (SCoDA). The graph is never stored, the state is
+		linear in the number of nodes. When an edge arrives and both communities of its endpoints
+		have a volume of at most maxVolume, the endpoint in the community with the smaller volume
+		joins the community of the other endpoint.
+
+		Parameters:
+		-----------
+		maxVolume : double
+			Communities with a larger volume neither gain nor lose nodes.
+	"""
+	cdef _StreamingClustering* _this
+
+	def __cinit__(self, edgeweight maxVolume):
+		self._this = new _StreamingClustering(maxVolume)
+
+	def __dealloc__(self):
+		del self._this
+
+	def addEdge(self, node u, node v, edgeweight w=1.0):
+		""" Processes the edge {u, v} with weight w.
+
+			Parameters:
+			-----------
+			u : node
+				The first endpoint.
+			v : node
+				The second endpoint.
+			w : double, optional
+				The weight of the edge.
+		"""
+		self._this.addEdge(u, v, w)
+
+	def update(self, event):
+		""" Processes a graph event.
+
+			Parameters:
+			-----------
+			event : GraphEvent
+				The event.
+		"""
+		self._this.update(_GraphEvent(event.type, event.u, event.v, event.w))
+
+	def updateBatch(self, batch):
+		""" Processes a sequence of graph events in order.
+
+			Parameters:
+			-----------
+			batch : list of GraphEvent
+				The events.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for event in batch:
+			_batch.push_back(_GraphEvent(event.type, event.u, event.v, event.w))
+		self._this.updateBatch(_batch)
+
+	def readEdgeList(self, path, separator="\t", firstNode=0, commentPrefix="#"):
+		""" Processes all edges of an edge list file, which is read line by line.
+
+			Parameters:
+			-----------
+			path : str
+				Path of the edge list file.
+			separator : str, optional
+				Character that separates the columns.
+			firstNode : node, optional
+				The id of the first node in the file.
+			commentPrefix : str, optional
+				Lines with this prefix are skipped.
+		"""
+		self._this.readEdgeList(stdstring(path), stdstring(separator)[0], firstNode, stdstring(commentPrefix))
+
+	def getPartition(self):
+		""" Returns the partition of the nodes seen so far.
+
+			Returns:
+			--------
+			networkit.Partition
+				The partition.
+		"""
+		return Partition().setThis(self._this.getPartition())
+
+	def refine(self, Graph G not None):
+		""" Refines the partition with PLM on the graph coarsened by the partition.
+
+			Parameters:
+			-----------
+			G : networkit.Graph
+				The graph of the stream.
+
+			Returns:
+			--------
+			networkit.Partition
+				A partition of G.
+		"""
+		return Partition().setThis(self._this.refine(G._this))
+
+	def upperNodeIdBound(self):
+		""" Returns an upper bound for the node ids seen so far. """
+		return self._this.upperNodeIdBound()
+
+	def numberOfEdges(self):
+		""" Returns the number of edges processed so far. """
+		return self._this.numberOfEdges()
+
+cdef extern from "<networkit/community/ParallelLeiden.hpp>" namespace "NetworKit::ParallelLeiden":
+
+	cdef enum _LeidenQuality "NetworKit::ParallelLeiden::Quality":
+		modularity
+		cpm
+
+class LeidenQuality(object):
+	Modularity = modularity
+	CPM = cpm
+
+cdef extern from "<networkit/community/ParallelLeiden.hpp>":
+
+	cdef cppclass _ParallelLeiden "NetworKit::ParallelLeiden"(_CommunityDetectionAlgorithm):
+		_ParallelLeiden(_Graph _G, double gamma, _LeidenQuality quality, count iterations, bool_t randomize, count maxIter) except +
+		count numberOfIterations() except +
+
+cdef class ParallelLeiden(CommunityDetector):
+	""" Parallel Leiden algorithm - a multi-level community detection algorithm that refines the
+		communities of the Louvain method such that they are guaranteed to be connected.
+
+		Parameters:
+		-----------
+		G : networkit.Graph
+			A graph.
+		gamma : double
+			Resolution parameter; for modularity, 1.0 yields standard modularity, for CPM, communities
+			have a density of at least gamma.
+		quality : networkit.community.LeidenQuality
+			Quality function to optimize: LeidenQuality.Modularity or LeidenQuality.CPM.
+		iterations : count
+			Maximum number of Leiden iterations, every iteration starts from the previous result.
+		randomize : bool, optional
+			Process nodes in random order and merge subcommunities randomly during the refinement.
+		maxIter : count
+			Maximum number of rounds of each moving phase.
+	"""
+
+	def __cinit__(self, Graph G not None, gamma=1.0, quality=LeidenQuality.Modularity, iterations=3, randomize=True, maxIter=32):
+		self._G = G
+		self._this = new _ParallelLeiden(G._this, gamma, quality, iterations, randomize, maxIter)
+
+	def numberOfIterations(self):
+		""" Get number of Leiden iterations in the last run.
+
+		Returns:
+		--------
+		count
+			The number of iterations.
+		"""
+		return (<_ParallelLeiden*>(self._this)).numberOfIterations()
+
 cdef extern from "<networkit/community/PLP.hpp>":
 
 	cdef cppclass _PLP "NetworKit::PLP"(_CommunityDetectionAlgorithm):
@@ -986,6 +1220,196 @@ cdef class PartitionFragmentation(LocalPartitionEvaluation):
 	def __cinit__(self):
 		self._this = new _PartitionFragmentation(self._G._this, self._P._this)
 
+cdef extern from "<networkit/community/EgoSplitting.hpp>" namespace "NetworKit::EgoSplitting":
+
+	cdef enum _EgoSplittingClustering "NetworKit::EgoSplitting::Clustering":
+		egoSplittingPLP "NetworKit::EgoSplitting::Clustering::PLP"
+		egoSplittingPLM "NetworKit::EgoSplitting::Clustering::PLM"
+
+class EgoSplittingClustering(object):
+	PLP = egoSplittingPLP
+	PLM = egoSplittingPLM
+
+cdef extern from "<networkit/community/EgoSplitting.hpp>":
+
+	cdef cppclass _EgoSplitting "NetworKit::EgoSplitting"(_Algorithm):
+		_EgoSplitting(_Graph G, _EgoSplittingClustering localClustering, _EgoSplittingClustering globalClustering) except +
+		_Cover getCover() except +
+		_Graph getPersonaGraph() except +
+		vector[node] getPersonaNodes() except +
+		count numberOfPersonas() except +
+
+cdef class EgoSplitting(Algorithm):
+	"""
+	Overlapping community detection with the ego-splitting framework. Every node is split into
+	personas, one for each community of its ego-net; a partition of the resulting persona graph
+	yields a cover of the original graph.
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The graph, must be undirected and must not contain self-loops.
+	localClustering : networkit.community.EgoSplittingClustering
+		Algorithm that partitions the ego-nets: EgoSplittingClustering.PLP or EgoSplittingClustering.PLM.
+	globalClustering : networkit.community.EgoSplittingClustering
+		Algorithm that partitions the persona graph.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, localClustering=EgoSplittingClustering.PLP, globalClustering=EgoSplittingClustering.PLM):
+		self._G = G
+		self._this = new _EgoSplitting(G._this, localClustering, globalClustering)
+
+	def getCover(self):
+		""" Get the cover of the nodes of the graph.
+
+		Returns:
+		--------
+		networkit.Cover
+			The overlapping communities.
+		"""
+		return Cover().setThis((<_EgoSplitting*>(self._this)).getCover())
+
+	def getPersonaGraph(self):
+		""" Get the persona graph.
+
+		Returns:
+		--------
+		networkit.Graph
+			The persona graph.
+		"""
+		return Graph().setThis((<_EgoSplitting*>(self._this)).getPersonaGraph())
+
+	def getPersonaNodes(self):
+		""" Get the node of every persona.
+
+		Returns:
+		--------
+		list(int)
+			The node of every persona.
+		"""
+		return (<_EgoSplitting*>(self._this)).getPersonaNodes()
+
+	def numberOfPersonas(self):
+		""" Get the number of personas.
+
+		Returns:
+		--------
+		int
+			The number of personas.
+		"""
+		return (<_EgoSplitting*>(self._this)).numberOfPersonas()
+
+cdef extern from "<networkit/community/PartitionQualityEvaluation.hpp>" namespace "NetworKit::PartitionQualityEvaluation":
+
+	cdef enum _PartitionMeasure "NetworKit::PartitionQualityEvaluation::Measure":
+		MODULARITY
+		COVERAGE
+		EDGE_CUT
+		CONDUCTANCE
+		INTRAPARTITION_DENSITY
+		HUB_DOMINANCE
+		FRAGMENTATION
+
+class PartitionMeasure(object):
+	Modularity = MODULARITY
+	Coverage = COVERAGE
+	EdgeCut = EDGE_CUT
+	Conductance = CONDUCTANCE
+	IntrapartitionDensity = INTRAPARTITION_DENSITY
+	HubDominance = HUB_DOMINANCE
+	Fragmentation = FRAGMENTATION
+
+cdef extern from "<networkit/community/PartitionQualityEvaluation.hpp>":
+
+	cdef cppclass _PartitionQualityEvaluation "NetworKit::PartitionQualityEvaluation"(_Algorithm):
+		_PartitionQualityEvaluation(_Graph G, _Partition P) except +
+		_PartitionQualityEvaluation(_Graph G, _Partition P, vector[_PartitionMeasure] measures) except +
+		double getValue(_PartitionMeasure m) except +
+		vector[double] getClusterValues(_PartitionMeasure m) except +
+		vector[count] getClusterSizes() except +
+		vector[double] getClusterVolumes() except +
+		count numberOfClusters() except +
+
+cdef class PartitionQualityEvaluation(Algorithm):
+	"""
+	Evaluates several quality measures of a partition in a single parallel sweep over the graph:
+	modularity, coverage, edge cut, conductance, intra-partition density, hub dominance and
+	fragmentation, together with per-cluster statistics.
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The graph on which the measures shall be evaluated, must be undirected.
+	P : networkit.Partition
+		The partition that shall be evaluated.
+	measures : list of networkit.community.PartitionMeasure, optional
+		The measures that shall be evaluated; all measures by default.
+	"""
+	cdef Graph _G
+	cdef Partition _P
+
+	def __cinit__(self, Graph G not None, Partition P not None, measures=None):
+		cdef vector[_PartitionMeasure] selected
+		self._G = G
+		self._P = P
+		if measures is None:
+			self._this = new _PartitionQualityEvaluation(G._this, P._this)
+		else:
+			for m in measures:
+				selected.push_back(m)
+			self._this = new _PartitionQualityEvaluation(G._this, P._this, selected)
+
+	def getValue(self, m):
+		""" Get the global value of the measure m.
+
+		Returns:
+		--------
+		double
+			The global value.
+		"""
+		return (<_PartitionQualityEvaluation*>(self._this)).getValue(m)
+
+	def getClusterValues(self, m):
+		""" Get the value of the measure m for every cluster id.
+
+		Returns:
+		--------
+		list(double)
+			The values of the clusters.
+		"""
+		return (<_PartitionQualityEvaluation*>(self._this)).getClusterValues(m)
+
+	def getClusterSizes(self):
+		""" Get the number of nodes of every cluster id.
+
+		Returns:
+		--------
+		list(int)
+			The sizes of the clusters.
+		"""
+		return (<_PartitionQualityEvaluation*>(self._this)).getClusterSizes()
+
+	def getClusterVolumes(self):
+		""" Get the volume of every cluster id.
+
+		Returns:
+		--------
+		list(double)
+			The volumes of the clusters.
+		"""
+		return (<_PartitionQualityEvaluation*>(self._this)).getClusterVolumes()
+
+	def numberOfClusters(self):
+		""" Get the number of nonempty clusters.
+
+		Returns:
+		--------
+		int
+			The number of clusters.
+		"""
+		return (<_PartitionQualityEvaluation*>(self._this)).numberOfClusters()
+
 cdef extern from "<networkit/community/StablePartitionNodes.hpp>":
 
 	cdef cppclass _StablePartitionNodes "NetworKit::StablePartitionNodes"(_LocalPartitionEvaluation):
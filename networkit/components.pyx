@@ -11,7 +11,7 @@ ctypedef index node
 
 from .base cimport _Algorithm, Algorithm
 from .dynamics cimport _GraphEvent, GraphEvent
-from .graph cimport _Graph, Graph
+from .graph cimport _Graph, Graph, Edge
 from .structures cimport _Partition, Partition
 
 cdef extern from "<networkit/components/ConnectedComponents.hpp>":
@@ -120,6 +120,86 @@ cdef class ConnectedComponents(Algorithm):
 		"""
 		return Graph().setThis(_ConnectedComponents.extractLargestConnectedComponent(graph._this, compactGraph))
 
+cdef extern from "<networkit/components/AfforestConnectedComponents.hpp>":
+
+	cdef cppclass _AfforestConnectedComponents "NetworKit::AfforestConnectedComponents"(_Algorithm):
+		_AfforestConnectedComponents(_Graph G, count neighborRounds, count sampleSize) except +
+		count numberOfComponents() except +
+		count componentOfNode(node query) except +
+		_Partition getPartition() except +
+		map[index, count] getComponentSizes() except +
+		vector[vector[node]] getComponents() except +
+
+cdef class AfforestConnectedComponents(Algorithm):
+	""" Determines the connected components of an undirected graph in parallel with the Afforest
+	algorithm (neighbor sampling and concurrent union-find). The running time does not depend on
+	the diameter of the graph; the result is the same as the one of ConnectedComponents.
+
+	AfforestConnectedComponents(G, neighborRounds=2, sampleSize=1024)
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The graph.
+	neighborRounds : count, optional
+		Number of edges per node that are linked in the sampling phase.
+	sampleSize : count, optional
+		Number of nodes that are sampled to find the largest component.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, count neighborRounds=2, count sampleSize=1024):
+		self._G = G
+		self._this = new _AfforestConnectedComponents(G._this, neighborRounds, sampleSize)
+
+	def getPartition(self):
+		""" Get a Partition that represents the components.
+
+		Returns:
+		--------
+		networkit.Partition
+			A partition representing the found components.
+		"""
+		return Partition().setThis((<_AfforestConnectedComponents*>(self._this)).getPartition())
+
+	def numberOfComponents(self):
+		""" Get the number of connected components.
+
+		Returns:
+		--------
+		count:
+			The number of connected components.
+		"""
+		return (<_AfforestConnectedComponents*>(self._this)).numberOfComponents()
+
+	def componentOfNode(self, v):
+		"""  Get the the component in which node `v` is situated.
+
+		v : node
+			The node whose component is asked for.
+		"""
+		return (<_AfforestConnectedComponents*>(self._this)).componentOfNode(v)
+
+	def getComponentSizes(self):
+		""" Get the component sizes.
+
+		Returns:
+		--------
+		map:
+			The map from component to size.
+		"""
+		return (<_AfforestConnectedComponents*>(self._this)).getComponentSizes()
+
+	def getComponents(self):
+		""" Get the connected components, each as a list of nodes.
+
+		Returns:
+		--------
+		list:
+			The connected components.
+		"""
+		return (<_AfforestConnectedComponents*>(self._this)).getComponents()
+
 cdef extern from "<networkit/components/ParallelConnectedComponents.hpp>":
 
 	cdef cppclass _ParallelConnectedComponents "NetworKit::ParallelConnectedComponents"(_Algorithm):
@@ -277,6 +357,93 @@ cdef class StronglyConnectedComponents:
 		return self._this.getComponents()
 
 
+cdef extern from "<networkit/components/ParallelStronglyConnectedComponents.hpp>":
+
+	cdef cppclass _ParallelStronglyConnectedComponents "NetworKit::ParallelStronglyConnectedComponents"(_Algorithm):
+		_ParallelStronglyConnectedComponents(_Graph G) except +
+		count numberOfComponents() except +
+		count componentOfNode(node query) except +
+		_Partition getPartition() except +
+		map[index, count] getComponentSizes() except +
+		vector[vector[node]] getComponents() except +
+
+cdef class ParallelStronglyConnectedComponents(Algorithm):
+	""" Computes the strongly connected components of a directed graph in parallel by trimming,
+	a forward-backward search from a high-degree pivot and coloring of the remaining nodes.
+
+	ParallelStronglyConnectedComponents(G)
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The graph.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _ParallelStronglyConnectedComponents(G._this)
+
+	def getPartition(self):
+		"""
+		Returns a Partition object representing the strongly connected components.
+
+		Returns:
+		--------
+		Partition
+			The strongly connected components.
+		"""
+		return Partition().setThis((<_ParallelStronglyConnectedComponents*>(self._this)).getPartition())
+
+	def numberOfComponents(self):
+		"""
+		Returns the number of strongly connected components of the graph.
+
+		Returns:
+		--------
+		int
+			The number of strongly connected components.
+		"""
+		return (<_ParallelStronglyConnectedComponents*>(self._this)).numberOfComponents()
+
+	def componentOfNode(self, u):
+		"""
+		Returns the component of node `u`.
+
+		Parameters:
+		-----------
+		u : node
+			A node in the graph.
+
+		Returns:
+		int
+			The component of node `u`.
+		"""
+		return (<_ParallelStronglyConnectedComponents*>(self._this)).componentOfNode(u)
+
+	def getComponentSizes(self):
+		"""
+		Returns a map with the component indexes as keys, and their size as values.
+
+		Returns:
+		--------
+		map[index, count]
+			Map with component indexes as keys, and their size as values.
+		"""
+		return (<_ParallelStronglyConnectedComponents*>(self._this)).getComponentSizes()
+
+	def getComponents(self):
+		"""
+		Returns a list of components.
+
+		Returns:
+		--------
+		list[list[node]]
+			A list of components.
+		"""
+		return (<_ParallelStronglyConnectedComponents*>(self._this)).getComponents()
+
+
 cdef extern from "<networkit/components/WeaklyConnectedComponents.hpp>":
 
 	cdef cppclass _WeaklyConnectedComponents "NetworKit::WeaklyConnectedComponents"(_Algorithm):
@@ -397,6 +564,109 @@ cdef class BiconnectedComponents(Algorithm):
 		return (<_BiconnectedComponents*>(self._this)).getComponents()
 
 
+cdef extern from "<networkit/components/ParallelBiconnectedComponents.hpp>":
+
+	cdef cppclass _ParallelBiconnectedComponents "NetworKit::ParallelBiconnectedComponents"(_Algorithm):
+		_ParallelBiconnectedComponents(_Graph G) except +
+		count numberOfComponents() except +
+		vector[count] getComponentSizes() except +
+		vector[vector[node]] getComponents() except +
+		vector[index] getComponentsOfNode(node u) except +
+		bool_t isArticulationPoint(node u) except +
+		vector[node] getArticulationPoints() except +
+		vector[Edge] getBridges() except +
+
+cdef class ParallelBiconnectedComponents(Algorithm):
+	""" Determines the biconnected components, the articulation points and the bridges of an
+		undirected graph in parallel, following the algorithm of Tarjan and Vishkin.
+
+		Parameters:
+		-----------
+		G : networkit.Graph
+			The graph.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _ParallelBiconnectedComponents(G._this)
+
+	def numberOfComponents(self):
+		""" Returns the number of components.
+
+			Returns:
+			--------
+			count
+				The number of components.
+		"""
+		return (<_ParallelBiconnectedComponents*>(self._this)).numberOfComponents()
+
+	def getComponentSizes(self):
+		""" Returns the number of nodes of every component.
+
+			Returns:
+			--------
+			list(count)
+				The size of every component.
+		"""
+		return (<_ParallelBiconnectedComponents*>(self._this)).getComponentSizes()
+
+	def getComponents(self):
+		""" Returns all the components, each as a sorted list of nodes.
+
+			Returns:
+			--------
+			list(list(node))
+				The nodes of every component.
+		"""
+		return (<_ParallelBiconnectedComponents*>(self._this)).getComponents()
+
+	def getComponentsOfNode(self, node u):
+		""" Returns the components that contain node `u`.
+
+			Parameters:
+			-----------
+			u : node
+				The node.
+
+			Returns:
+			--------
+			list(index)
+				The components of `u` in increasing order.
+		"""
+		return (<_ParallelBiconnectedComponents*>(self._this)).getComponentsOfNode(u)
+
+	def isArticulationPoint(self, node u):
+		""" Returns whether the removal of `u` increases the number of connected components.
+
+			Parameters:
+			-----------
+			u : node
+				The node.
+		"""
+		return (<_ParallelBiconnectedComponents*>(self._this)).isArticulationPoint(u)
+
+	def getArticulationPoints(self):
+		""" Returns all articulation points in increasing order.
+
+			Returns:
+			--------
+			list(node)
+				The articulation points.
+		"""
+		return (<_ParallelBiconnectedComponents*>(self._this)).getArticulationPoints()
+
+	def getBridges(self):
+		""" Returns all edges whose removal increases the number of connected components.
+
+			Returns:
+			--------
+			list(tuple(node, node))
+				The bridges (u, v) with u < v, sorted.
+		"""
+		return [(e.u, e.v) for e in (<_ParallelBiconnectedComponents*>(self._this)).getBridges()]
+
+
 cdef extern from "<networkit/components/DynConnectedComponents.hpp>":
 
 	cdef cppclass _DynConnectedComponents "NetworKit::DynConnectedComponents"(_Algorithm):
@@ -489,6 +759,123 @@ cdef class DynConnectedComponents(Algorithm):
 
 
 
+cdef extern from "<networkit/components/DynHDTConnectedComponents.hpp>":
+
+	cdef cppclass _DynHDTConnectedComponents "NetworKit::DynHDTConnectedComponents"(_Algorithm):
+		_DynHDTConnectedComponents(_Graph G) except +
+		void update(_GraphEvent) except +
+		void updateBatch(vector[_GraphEvent]) except +
+		bool_t connected(node u, node v) except +
+		count numberOfComponents() except +
+		index componentOfNode(node query) except +
+		count componentSize(node query) except +
+		map[index, count] getComponentSizes() except +
+		vector[vector[node]] getComponents() except +
+
+cdef class DynHDTConnectedComponents(Algorithm):
+	""" Maintains the connected components of an undirected graph under edge insertions and
+		deletions with the algorithm of Holm, de Lichtenberg and Thorup, in polylogarithmic
+		amortized time per update. Components are identified by their smallest node.
+
+		Parameters:
+		-----------
+		G : networkit.Graph
+			The graph.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _DynHDTConnectedComponents(G._this)
+
+	def connected(self, node u, node v):
+		""" Returns whether `u` and `v` are in the same component.
+
+			Parameters:
+			-----------
+			u : node
+				The first node.
+			v : node
+				The second node.
+		"""
+		return (<_DynHDTConnectedComponents*>(self._this)).connected(u, v)
+
+	def numberOfComponents(self):
+		""" Returns the number of components.
+
+			Returns:
+			--------
+			count
+				The number of components.
+		"""
+		return (<_DynHDTConnectedComponents*>(self._this)).numberOfComponents()
+
+	def componentOfNode(self, v):
+		""" Returns the component of node `v`, i.e., its smallest node.
+
+			Parameters:
+			-----------
+			v : node
+				The node.
+		"""
+		return (<_DynHDTConnectedComponents*>(self._this)).componentOfNode(v)
+
+	def componentSize(self, v):
+		""" Returns the number of nodes in the component of node `v`.
+
+			Parameters:
+			-----------
+			v : node
+				The node.
+		"""
+		return (<_DynHDTConnectedComponents*>(self._this)).componentSize(v)
+
+	def getComponentSizes(self):
+		""" Returns the map from component to size.
+
+			Returns:
+			--------
+			map[index, count]
+				A map that maps each component to its size.
+		"""
+		return (<_DynHDTConnectedComponents*>(self._this)).getComponentSizes()
+
+	def getComponents(self):
+		""" Returns all the components in the order of their smallest node.
+
+			Returns:
+			--------
+			vector[vector[node]]
+				A vector of vectors. Each inner vector contains all the nodes inside the component.
+		"""
+		return (<_DynHDTConnectedComponents*>(self._this)).getComponents()
+
+	def update(self, event):
+		""" Updates the connected components after an edge insertion or
+			deletion.
+
+			Parameters:
+			-----------
+			event : GraphEvent
+				The event that happened (edge deletion or insertion).
+		"""
+		(<_DynHDTConnectedComponents*>(self._this)).update(_GraphEvent(event.type, event.u, event.v, event.w))
+
+	def updateBatch(self, batch):
+		""" Updates the connected components after a batch of edge insertions and
+			deletions.
+
+			Parameters:
+			-----------
+			batch : vector[GraphEvent]
+				A vector that contains a batch of edge insertions and deletions.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for event in batch:
+			_batch.push_back(_GraphEvent(event.type, event.u, event.v, event.w))
+		(<_DynHDTConnectedComponents*>(self._this)).updateBatch(_batch)
+
+
 cdef extern from "<networkit/components/DynWeaklyConnectedComponents.hpp>":
 
 	cdef cppclass _DynWeaklyConnectedComponents "NetworKit::DynWeaklyConnectedComponents"(_Algorithm):
@@ -26,6 +26,7 @@
 #include <networkit/auxiliary/BucketPQ.hpp>
 #include <networkit/auxiliary/StringTools.hpp>
 #include <networkit/auxiliary/SetIntersector.hpp>
+#include <networkit/auxiliary/SortedIntersection.hpp>
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/NumberParsing.hpp>
 #include <networkit/auxiliary/Enforce.hpp>
@@ -352,6 +353,38 @@ TEST_F(AuxGTest, testSetIntersector) {
     EXPECT_EQ(expectedResult, intersection);
 }
 
+TEST_F(AuxGTest, testSortedIntersection) {
+    Aux::Random::setSeed(42, false);
+
+    // Covers balanced inputs (merge/SIMD blocks), unbalanced inputs (galloping) and empty ones.
+    for (uint64_t sizeA : {0, 1, 3, 8, 17, 100, 1000}) {
+        for (uint64_t sizeB : {0, 2, 5, 16, 33, 250, 5000}) {
+            std::set<uint64_t> setA, setB;
+            while (setA.size() < sizeA)
+                setA.insert(Aux::Random::integer(2 * (sizeA + sizeB)));
+            while (setB.size() < sizeB)
+                setB.insert(Aux::Random::integer(2 * (sizeA + sizeB)));
+            const std::vector<uint64_t> A(setA.begin(), setA.end()), B(setB.begin(), setB.end());
+
+            std::vector<uint64_t> expected;
+            std::set_intersection(A.begin(), A.end(), B.begin(), B.end(),
+                                  std::back_inserter(expected));
+
+            EXPECT_EQ(Aux::SortedIntersection::intersectionSize(A, B), expected.size());
+            EXPECT_EQ(Aux::SortedIntersection::intersectionSize(B, A), expected.size());
+            EXPECT_EQ(Aux::SortedIntersection::intersect(A, B), expected);
+
+            std::vector<uint64_t> reported;
+            Aux::SortedIntersection::forIntersection(
+                A.data(), A.size(), B.data(), B.size(), [&](size_t i, size_t j) {
+                    EXPECT_EQ(A[i], B[j]);
+                    reported.push_back(A[i]);
+                });
+            EXPECT_EQ(reported, expected);
+        }
+    }
+}
+
 TEST_F(AuxGTest, testEnforce) {
     EXPECT_THROW(Aux::enforce(false), std::runtime_error);
     EXPECT_NO_THROW(Aux::enforce(true));
@@ -0,0 +1,177 @@
+/*
+ * ApproxLocalClusteringCoefficient.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/Timer.hpp>
+#include <networkit/centrality/ApproxLocalClusteringCoefficient.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/SortedAdjacency.hpp>
+
+namespace NetworKit {
+
+ApproxLocalClusteringCoefficient::ApproxLocalClusteringCoefficient(const Graph &G, double epsilon,
+                                                                   double delta, count timeLimit)
+    : Centrality(G, false, false), epsilon(epsilon), delta(delta), timeLimit(timeLimit) {
+    if (G.isDirected())
+        throw std::runtime_error("Not implemented: Local clustering coefficient is currently not "
+                                 "implemented for directed graphs");
+    if (G.numberOfSelfLoops())
+        throw std::runtime_error("Local Clustering Coefficient implementation does not support "
+                                 "graphs with self-loops. Call Graph.removeSelfLoops() first.");
+    if (epsilon <= 0 || epsilon >= 1)
+        throw std::runtime_error("Error: epsilon must be in (0, 1)");
+    if (delta <= 0 || delta >= 1)
+        throw std::runtime_error("Error: delta must be in (0, 1)");
+}
+
+index ApproxLocalClusteringCoefficient::degreeClass(count deg) noexcept {
+    index result = 0;
+    while (deg >>= 1)
+        ++result;
+    return result;
+}
+
+void ApproxLocalClusteringCoefficient::run() {
+    Aux::SignalHandler handler;
+    Aux::Timer timer;
+    timer.start();
+
+    const count z = G.upperNodeIdBound();
+    // Hoeffding: Pr[|estimate - c(u)| > epsilon] <= 2 exp(-2 samples epsilon^2) <= delta.
+    const double logTerm = std::log(2.0 / delta);
+    const count targetSamples = static_cast<count>(std::ceil(logTerm / (2 * epsilon * epsilon)));
+
+    const SortedAdjacency neighbors(G);
+    auto adjacent = [&](node v, node w) -> bool {
+        if (neighbors.degree(v) > neighbors.degree(w))
+            std::swap(v, w);
+        const node *begin = neighbors.neighbors(v);
+        return std::binary_search(begin, begin + neighbors.degree(v), w);
+    };
+    auto wedges = [&](node u) -> count { return G.degree(u) * (G.degree(u) - 1) / 2; };
+
+    // Nodes with more wedges than required samples are sampled, the others are evaluated exactly.
+    std::vector<node> sampledNodes;
+    std::vector<unsigned char> isSampled(z, 0);
+    G.forNodes([&](node u) {
+        if (G.degree(u) >= 2 && wedges(u) > targetSamples) {
+            sampledNodes.push_back(u);
+            isSampled[u] = 1;
+        }
+    });
+
+    std::vector<count> closed(z, 0);
+    G.balancedParallelForNodes([&](node u) {
+        if (isSampled[u])
+            return;
+        const count d = neighbors.degree(u);
+        const node *adj = neighbors.neighbors(u);
+        count found = 0;
+        for (index i = 0; i < d; ++i)
+            for (index j = i + 1; j < d; ++j)
+                found += adjacent(adj[i], adj[j]);
+        closed[u] = found;
+    });
+
+    // Every sampled node receives the same number of samples; the rounds double in size such
+    // that the time limit is checked regularly without much synchronization.
+    count samplesPerNode = 0;
+    count roundSize = std::min<count>(targetSamples, 256);
+    while (!sampledNodes.empty() && samplesPerNode < targetSamples) {
+        handler.assureRunning();
+        const count batch = std::min(roundSize, targetSamples - samplesPerNode);
+
+#pragma omp parallel for schedule(dynamic, 16)
+        for (omp_index i = 0; i < static_cast<omp_index>(sampledNodes.size()); ++i) {
+            const node u = sampledNodes[i];
+            const count d = neighbors.degree(u);
+            const node *adj = neighbors.neighbors(u);
+            auto &urng = Aux::Random::getURNG();
+            std::uniform_int_distribution<index> first(0, d - 1), second(0, d - 2);
+
+            count found = 0;
+            for (count s = 0; s < batch; ++s) {
+                const index x = first(urng);
+                index y = second(urng);
+                if (y >= x)
+                    ++y;
+                found += adjacent(adj[x], adj[y]);
+            }
+            closed[u] += found;
+        }
+
+        samplesPerNode += batch;
+        roundSize *= 2;
+        if (timeLimit && timer.elapsedMilliseconds() >= timeLimit)
+            break;
+    }
+
+    errorBoundReached = sampledNodes.empty() || samplesPerNode >= targetSamples;
+    // At least one round is completed, hence samplesPerNode > 0 if any node is sampled.
+    const double sampledError =
+        std::sqrt(logTerm / (2.0 * static_cast<double>(std::max<count>(samplesPerNode, 1))));
+    INFO("took ", samplesPerNode, " samples for each of ", sampledNodes.size(), " nodes");
+
+    scoreData.assign(z, 0.0);
+    lowerBounds.assign(z, 0.0);
+    upperBounds.assign(z, 0.0);
+    G.parallelForNodes([&](node u) {
+        if (G.degree(u) < 2)
+            return;
+        if (!isSampled[u]) {
+            scoreData[u] = lowerBounds[u] = upperBounds[u] =
+                static_cast<double>(closed[u]) / static_cast<double>(wedges(u));
+            return;
+        }
+        scoreData[u] = static_cast<double>(closed[u]) / static_cast<double>(samplesPerNode);
+        lowerBounds[u] = std::max(0.0, scoreData[u] - sampledError);
+        upperBounds[u] = std::min(1.0, scoreData[u] + sampledError);
+    });
+
+    totalSamples = samplesPerNode * sampledNodes.size();
+    G.forNodes([&](node u) {
+        if (!isSampled[u] && G.degree(u) >= 2)
+            totalSamples += wedges(u);
+    });
+
+    // The average of the estimates of a degree class is a sum of independent samples, each
+    // bounded by 1 / (|C| * samplesPerNode); Hoeffding's inequality applies again.
+    const count numClasses = degreeClass(G.isEmpty() ? 0 : GraphTools::maxDegree(G)) + 1;
+    classSizes.assign(numClasses, 0);
+    classScores.assign(numClasses, 0.0);
+    std::vector<count> sampledPerClass(numClasses, 0);
+    G.forNodes([&](node u) {
+        const index c = degreeClass(G.degree(u));
+        ++classSizes[c];
+        classScores[c] += scoreData[u];
+        sampledPerClass[c] += isSampled[u];
+    });
+
+    classLowerBounds.assign(numClasses, 0.0);
+    classUpperBounds.assign(numClasses, 0.0);
+    for (index c = 0; c < numClasses; ++c) {
+        if (!classSizes[c])
+            continue;
+        const double size = static_cast<double>(classSizes[c]);
+        classScores[c] /= size;
+        const double error =
+            sampledError * std::sqrt(static_cast<double>(sampledPerClass[c])) / size;
+        classLowerBounds[c] = std::max(0.0, classScores[c] - error);
+        classUpperBounds[c] = std::min(1.0, classScores[c] + error);
+    }
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
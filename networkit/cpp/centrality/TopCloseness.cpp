@@ -7,6 +7,7 @@
 
 // networkit-format
 
+#include <algorithm>
 #include <omp.h>
 #include <queue>
 #include <stack>
@@ -39,14 +40,30 @@ void TopCloseness::init() {
     DEBUG("k = ", k);
     farness.clear();
     farness.resize(n, 0);
+    const count threads = omp_get_max_threads();
+    visitedGlobal.resize(threads, std::vector<uint16_t>(n));
+    tsGlobal.resize(threads, 0);
+    queueGlobal.resize(threads);
     if (sec_heu) {
-        nodesPerLevs.resize(omp_get_max_threads(), std::vector<count>(n));
-        sumLevels.resize(omp_get_max_threads(), std::vector<count>(n));
+        nodesPerLevs.resize(threads, std::vector<count>(n));
+        sumLevels.resize(threads, std::vector<count>(n));
+    } else {
+        distGlobal.resize(threads, std::vector<count>(n));
+        predGlobal.resize(threads, std::vector<node>(n));
     }
     computeReachable();
     DEBUG("Done INIT");
 }
 
+void TopCloseness::updateTimestamp() {
+    auto &visited = visitedGlobal[omp_get_thread_num()];
+    auto &ts = tsGlobal[omp_get_thread_num()];
+    if (ts++ == std::numeric_limits<uint16_t>::max()) {
+        ts = 1;
+        std::fill(visited.begin(), visited.end(), 0);
+    }
+}
+
 void TopCloseness::computeReachable() {
     if (G.isDirected()) {
         sccsPtr = std::make_unique<StronglyConnectedComponents>(G);
@@ -259,29 +276,46 @@ void TopCloseness::computelBound1(std::vector<double> &S) {
 
 void TopCloseness::BFSbound(node x, std::vector<double> &S2, count &visEdges,
                             const std::vector<bool> &toAnalyze) {
-    count r = 0;
-    std::vector<std::vector<node>> levels(n);
+    updateTimestamp();
+    auto &visited = visitedGlobal[omp_get_thread_num()];
+    const auto ts = tsGlobal[omp_get_thread_num()];
+    // The queue contains the visited nodes in BFS order; level i consists of the positions
+    // [sumLevs[i - 1], sumLevs[i]).
+    auto &queue = queueGlobal[omp_get_thread_num()];
     // nodesPerLev[i] contains the number of nodes in level i
     std::vector<count> &nodesPerLev = nodesPerLevs[omp_get_thread_num()];
-    std::fill(nodesPerLev.begin(), nodesPerLev.end(), 0);
     // sumLevs[i] contains the sum of the nodes in levels j <= i
     std::vector<count> &sumLevs = sumLevels[omp_get_thread_num()];
-    std::fill(sumLevs.begin(), sumLevs.end(), 0);
+
+    queue.clear();
+    queue.push_back(x);
+    visited[x] = ts;
     count nLevs = 0;
+    index levelBegin = 0;
     double sum_dist = 0;
-    Traversal::BFSfrom(G, x, [&](node u, count dist) {
-        sum_dist += dist;
-        r++;
-        if (dist > nLevs) {
-            sumLevs[nLevs] += nodesPerLev[nLevs];
-            sumLevs[nLevs + 1] = sumLevs[nLevs];
-            nLevs++;
-            levels[nLevs].clear();
+    while (true) {
+        const index levelEnd = queue.size();
+        nodesPerLev[nLevs] = levelEnd - levelBegin;
+        sum_dist += static_cast<double>(nLevs * (levelEnd - levelBegin));
+        for (index i = levelBegin; i < levelEnd; ++i) {
+            G.forNeighborsOf(queue[i], [&](node w) {
+                if (visited[w] != ts) {
+                    visited[w] = ts;
+                    queue.push_back(w);
+                }
+            });
         }
-        levels[nLevs].push_back(u);
-        nodesPerLev[nLevs]++;
-    });
-    sumLevs[nLevs] += nodesPerLev[nLevs];
+        if (queue.size() == levelEnd)
+            break;
+        levelBegin = levelEnd;
+        ++nLevs;
+    }
+
+    const count r = queue.size();
+    sumLevs[0] = nodesPerLev[0];
+    for (count i = 1; i <= nLevs; ++i)
+        sumLevs[i] = sumLevs[i - 1] + nodesPerLev[i];
+
     if (G.isDirected()) {
         visEdges += G.numberOfEdges();
     } else {
@@ -300,8 +334,8 @@ void TopCloseness::BFSbound(node x, std::vector<double> &S2, count &visEdges,
 
     edgeweight level_bound = 2.0 * closeNodes + static_cast<double>(farNodes);
     const auto &reachU = *(reachUPtr.get());
-    for (count j = 0; j < levels[1].size(); j++) {
-        node w = levels[1][j];
+    for (index j = sumLevs[0]; j < (nLevs ? sumLevs[1] : sumLevs[0]); j++) {
+        node w = queue[j];
         // we subtract 2 not to count the node itself
         double bound =
             (level_bound - 2 - G.degree(w)) * (n - 1.0) / (reachU[w] - 1.0) / (reachU[w] - 1.0);
@@ -319,8 +353,8 @@ void TopCloseness::BFSbound(node x, std::vector<double> &S2, count &visEdges,
         if (i < nLevs) {
             level_bound -= static_cast<edgeweight>(sumLevs[nLevs] - sumLevs[i + 1]);
         }
-        for (count j = 0; j < levels[i].size(); j++) {
-            node w = levels[i][j];
+        for (index j = sumLevs[i - 1]; j < sumLevs[i]; j++) {
+            node w = queue[j];
             double bound =
                 (level_bound - 2 - G.degree(w)) * (n - 1.0) / (reachU[w] - 1.0) / (reachU[w] - 1.0);
             if (toAnalyze[w] && bound > S2[w]
@@ -333,27 +367,32 @@ void TopCloseness::BFSbound(node x, std::vector<double> &S2, count &visEdges,
     }
 }
 
-double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
-                            std::vector<count> &distances, std::vector<node> &pred,
-                            count &visEdges) {
+double TopCloseness::BFScut(node v, const std::atomic<double> &kth, count &visEdges) {
+    updateTimestamp();
+    auto &visited = visitedGlobal[omp_get_thread_num()];
+    const auto ts = tsGlobal[omp_get_thread_num()];
+    auto &queue = queueGlobal[omp_get_thread_num()];
+    auto &distances = distGlobal[omp_get_thread_num()];
+    auto &pred = predGlobal[omp_get_thread_num()];
+
     count d = 0, f = 0, nd = 1;
     const double rL = (*reachLPtr)[v], rU = (*reachUPtr)[v];
-    std::queue<node> Q1;
-    std::queue<node> to_reset;
     count sum_dist = 0;
     double ftildeL = 0, ftildeU = 0, gamma = G.degreeOut(v);
     double farnessV = 0;
+    bool cut = false;
 
-    // MICHELE: variable visited is not local, otherwise the allocation would be
-    // too expensive.
-    visited[v] = true;
+    visited[v] = ts;
     distances[v] = 0;
-    Q1.push(v);
-    to_reset.push(v);
+    queue.clear();
+    queue.push_back(v);
+    index front = 0;
 
     do {
-        node u = Q1.front();
-        Q1.pop();
+        node u = queue[front++];
+        // The k-th farness is read again for every node, such that improvements found by other
+        // threads immediately tighten the cut.
+        const double x = kth.load(std::memory_order_relaxed);
 
         sum_dist += distances[u];
         if (distances[u] > d) { // Need to update bounds!
@@ -364,8 +403,10 @@ double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
             f1 = f + static_cast<double>(d + 2) * static_cast<double>(rU - nd) - gamma;
             f2 = static_cast<double>(n - 1) / (rU - 1.0) / (rU - 1.0);
             ftildeU = f1 * f2;
-            if (std::min(ftildeL, ftildeU) >= x) {
+            // The cut must be strict: a node whose bound equals the k-th farness may tie with it.
+            if (std::min(ftildeL, ftildeU) > x) {
                 farnessV = std::min(ftildeL, ftildeU);
+                cut = true;
                 break;
             }
             gamma = 0;
@@ -374,11 +415,10 @@ double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
         G.forNeighborsOf(u, [&](node w) {
             if (cont) {
                 ++visEdges;
-                if (!visited[w]) {
+                if (visited[w] != ts) {
                     distances[w] = distances[u] + 1;
-                    Q1.push(w);
-                    to_reset.push(w);
-                    visited[w] = true;
+                    queue.push_back(w);
+                    visited[w] = ts;
                     f += distances[w];
                     if (!G.isDirected())
                         gamma += static_cast<double>(G.degree(w)
@@ -400,19 +440,12 @@ double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
         });
         if (std::min(ftildeL, ftildeU) > x) {
             farnessV = std::min(ftildeL, ftildeU);
+            cut = true;
             break;
         }
-    } while (!Q1.empty());
+    } while (front < queue.size());
 
-    do {
-        // MICHELE: need to reset variable visited.
-        // Variables pred and distances
-        // do not need to be updated.
-        node u = to_reset.front();
-        to_reset.pop();
-        visited[u] = false;
-    } while (!to_reset.empty());
-    if (farnessV < x) {
+    if (!cut) {
         farnessV = static_cast<double>(sum_dist * (n - 1)) / static_cast<double>(nd - 1.0)
                    / static_cast<double>(nd - 1.0);
     }
@@ -452,19 +485,11 @@ void TopCloseness::run() {
     Q.build_heap(std::move(nodes));
     DEBUG("Done filling the queue");
 
-    std::vector<std::vector<bool>> visitedVec;
-    std::vector<std::vector<count>> distVec;
-    std::vector<std::vector<node>> predVec;
-
-    if (!sec_heu) {
-        visitedVec.resize(omp_get_max_threads(), std::vector<bool>(n));
-        distVec.resize(omp_get_max_threads(), std::vector<count>(n));
-        predVec.resize(omp_get_max_threads(), std::vector<node>(n));
-    }
-
-    double kth = std::numeric_limits<double>::max(); // like in Crescenzi
-#pragma omp parallel                                 // Shared variables:
-    // cc: synchronized write, read leads to a positive race condition;
+    // The k-th farness is published atomically: it is only written while holding the lock, but
+    // read without synchronization by the BFSs of all threads.
+    std::atomic<double> kth{std::numeric_limits<double>::max()}; // like in Crescenzi
+#pragma omp parallel                                              // Shared variables:
+    // kth: synchronized write, lock-free read;
     // Q: fully synchronized;
     // top: fully synchronized;
     // toAnalyze: fully synchronized;
@@ -487,7 +512,7 @@ void TopCloseness::run() {
             toAnalyze[s] = false;
             omp_unset_lock(&lock);
 
-            if (G.degreeOut(s) == 0 || farness[s] > kth) {
+            if (G.degreeOut(s) == 0 || farness[s] > kth.load(std::memory_order_relaxed)) {
                 break;
             }
             DEBUG("Iteration ", ++iters, " of thread ", omp_get_thread_num());
@@ -523,12 +548,8 @@ void TopCloseness::run() {
                 DEBUG("    We have improved ", imp, " bounds.");
             } else {
                 // MICHELE: we use BFScut to bound the centrality of s.
-                DEBUG("    Running BFScut with x=", kth, " (degree:", G.degreeOut(s), ").");
-                auto &visited = visitedVec[omp_get_thread_num()];
-                std::fill(visited.begin(), visited.end(), false);
-                auto &distances = distVec[omp_get_thread_num()];
-                auto &pred = predVec[omp_get_thread_num()];
-                const double farnessS = BFScut(s, kth, visited, distances, pred, visEdges);
+                DEBUG("    Running BFScut with x=", kth.load(), " (degree:", G.degreeOut(s), ").");
+                const double farnessS = BFScut(s, kth, visEdges);
                 DEBUG("    Visited edges: ", visEdges, ".");
                 omp_set_lock(&lock);
                 farness[s] = farnessS;
@@ -537,12 +558,12 @@ void TopCloseness::run() {
 
             // If necessary, we update kth.
             omp_set_lock(&lock);
-            if (farness[s] <= kth) {
+            if (farness[s] <= kth.load(std::memory_order_relaxed)) {
                 DEBUG("    The closeness of s is ", 1.0 / farness[s], ".");
                 top.push(s);
                 if (top.size() > k) {
                     ++trail;
-                    if (farness[s] < kth) {
+                    if (farness[s] < kth.load(std::memory_order_relaxed)) {
                         if (nMaxFarness == trail) {
                             // Purging trail
                             do {
@@ -583,9 +604,9 @@ void TopCloseness::run() {
 
             // We load the new value of kth.
             if (top.size() >= k) {
-                kth = farness[top.top()];
+                kth.store(farness[top.top()], std::memory_order_relaxed);
                 if (nMaxFarness == 1) {
-                    maxFarness = kth;
+                    maxFarness = farness[top.top()];
                 }
             }
             omp_unset_lock(&lock);
@@ -10,7 +10,6 @@
 #ifndef NDEBUG
 #include <algorithm>
 #endif
-#include <atomic>
 #include <omp.h>
 #include <queue>
 
@@ -35,6 +34,9 @@ TopHarmonicCloseness::TopHarmonicCloseness(const Graph &G, count k, bool useNBbo
     hCloseness.resize(n);
     reachableNodes.resize(n);
 
+    visitedGlobal.resize(omp_get_max_threads(), std::vector<uint16_t>(n));
+    tsGlobal.resize(omp_get_max_threads(), 0);
+
     if (!useNBbound && G.isWeighted()) {
         distanceGlobal.resize(omp_get_max_threads(), std::vector<edgeweight>(n));
         dijkstraHeaps.reserve(omp_get_max_threads());
@@ -43,8 +45,7 @@ TopHarmonicCloseness::TopHarmonicCloseness(const Graph &G, count k, bool useNBbo
         minEdgeWeight = std::numeric_limits<edgeweight>::max();
         G.forEdges([&](node, node, edgeweight ew) { minEdgeWeight = std::min(minEdgeWeight, ew); });
     } else {
-        visitedGlobal.resize(omp_get_max_threads(), std::vector<uint8_t>(n));
-        tsGlobal.resize(omp_get_max_threads(), 0);
+        queueGlobal.resize(omp_get_max_threads());
     }
 
     topKNodesPQ.reserve(k);
@@ -104,6 +105,8 @@ void TopHarmonicCloseness::runNBcut() {
     prioQ.build_heap(G->nodeRange().begin(), G->nodeRange().end());
 
     std::atomic_bool stop{false};
+    // Only written while holding the lock, but read without synchronization by the searches of
+    // all threads such that a new k-th closeness immediately tightens all running cuts.
     std::atomic<double> kthCloseness{-1};
 
 #pragma omp parallel
@@ -126,30 +129,23 @@ void TopHarmonicCloseness::runNBcut() {
             break;
 
         if (G->isWeighted()) {
-            if (!bfscutWeighted(u, kthCloseness.load(std::memory_order_relaxed)))
+            if (!bfscutWeighted(u, kthCloseness))
                 continue;
         } else {
-            if (!bfscutUnweighted(u, kthCloseness.load(std::memory_order_relaxed)))
+            if (!bfscutUnweighted(u, kthCloseness))
                 continue;
         }
 
         omp_set_lock(&lock);
         updateTopkPQ(u);
+        if (topKNodesPQ.size() == k)
+            kthCloseness.store(hCloseness[topKNodesPQ.top()], std::memory_order_relaxed);
         omp_unset_lock(&lock);
     }
 }
 
 void TopHarmonicCloseness::runNBbound() {
-    numberOfNodesAtLevelGlobal.resize(omp_get_max_threads(),
-                                      std::vector<count>(G->numberOfNodes(), 0));
-    nodesAtLevelGlobal.resize(omp_get_max_threads(),
-                              std::vector<std::vector<count>>(G->numberOfNodes()));
-    nodesAtCurrentLevelGlobal.resize(omp_get_max_threads());
-
-    for (int i = 0; i < omp_get_max_threads(); ++i)
-        nodesAtCurrentLevelGlobal[i].reserve(G->numberOfNodes() - 1);
-
-    levelImprovement.resize(G->numberOfNodes());
+    levelStartGlobal.resize(omp_get_max_threads());
 
     if (G->isDirected())
         computeReachableNodesBounds();
@@ -204,7 +200,8 @@ void TopHarmonicCloseness::updateTopkPQ(node u) {
         trail.clear();
 }
 
-bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
+bool TopHarmonicCloseness::bfscutUnweighted(node source,
+                                            const std::atomic<double> &kthCloseness) {
     const count reachableFromSource = reachableNodes[source];
     const count undirected = !G->isDirected();
     updateTimestamp();
@@ -213,27 +210,28 @@ bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
     visited[source] = ts;
     count visitedNodes = 1, level = 1;
 
-    std::queue<node> q1, q2;
-    q1.push(source);
+    // Nodes in BFS order; the current level consists of the positions [levelBegin, levelEnd).
+    auto &queue = queueGlobal[omp_get_thread_num()];
+    queue.clear();
+    queue.push_back(source);
+    index levelBegin = 0;
 
     double h = 0, htilde = 0;
 
     do {
+        const index levelEnd = queue.size();
         count nodesAtNextLevelUB = 0;
-        do {
-            const node u = q1.front();
-            q1.pop();
-
-            G->forNeighborsOf(u, [&](node v) {
+        for (index i = levelBegin; i < levelEnd; ++i) {
+            G->forNeighborsOf(queue[i], [&](node v) {
                 if (visited[v] == ts)
                     return;
                 visited[v] = ts;
-                q2.push(v);
+                queue.push_back(v);
                 ++visitedNodes;
                 h += 1. / static_cast<double>(level);
                 nodesAtNextLevelUB += G->degree(v) - undirected;
             });
-        } while (!q1.empty());
+        }
 
         assert(reachableFromSource >= visitedNodes);
         nodesAtNextLevelUB = std::min(nodesAtNextLevelUB, reachableFromSource - visitedNodes);
@@ -243,7 +241,7 @@ bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
                   / static_cast<double>(level + 2);
 
 #ifndef NDEBUG
-        if (q2.empty()) { // Finished the BFS
+        if (queue.size() == levelEnd) { // Finished the BFS
             if (G->isDirected())
                 assert(reachableFromSource >= visitedNodes);
             else
@@ -252,22 +250,26 @@ bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
 #endif
 
         // Prune BFS
-        if (htilde < kthCloseness) {
+        if (htilde < kthCloseness.load(std::memory_order_relaxed)) {
             hCloseness[source] = htilde;
             return false;
         }
 
         ++level;
-        std::swap(q1, q2);
-    } while (!q1.empty());
+        levelBegin = levelEnd;
+    } while (levelBegin < queue.size());
 
     hCloseness[source] = h;
     return true;
 }
 
-bool TopHarmonicCloseness::bfscutWeighted(node source, double kthCloseness) {
+bool TopHarmonicCloseness::bfscutWeighted(node source, const std::atomic<double> &kthCloseness) {
+    // distance[v] is only valid if v has been visited in the current search.
+    updateTimestamp();
+    auto &visited = visitedGlobal[omp_get_thread_num()];
+    const auto ts = tsGlobal[omp_get_thread_num()];
     auto &distance = distanceGlobal[omp_get_thread_num()];
-    std::fill(distance.begin(), distance.end(), std::numeric_limits<edgeweight>::max());
+    visited[source] = ts;
     distance[source] = 0;
     auto &pq = dijkstraHeaps[omp_get_thread_num()];
     pq.clear();
@@ -275,6 +277,7 @@ bool TopHarmonicCloseness::bfscutWeighted(node source, double kthCloseness) {
 
     // Visit the source immediately so we can avoid 'if (u != source) ... ' in the while loop below
     G->forNeighborsOf(source, [&](node v, edgeweight ew) {
+        visited[v] = ts;
         distance[v] = ew;
         pq.update(v);
     });
@@ -296,14 +299,15 @@ bool TopHarmonicCloseness::bfscutWeighted(node source, double kthCloseness) {
         htilde = h + static_cast<double>(reachableFromSource - visitedNodes) / distU;
 
         // Prune SSSP
-        if (htilde < kthCloseness) {
+        if (htilde < kthCloseness.load(std::memory_order_relaxed)) {
             hCloseness[source] = htilde;
             return false;
         }
 
         G->forNeighborsOf(u, [&](node v, edgeweight ew) {
             const double newDistV = distU + ew;
-            if (newDistV < distance[v]) {
+            if (visited[v] != ts || newDistV < distance[v]) {
+                visited[v] = ts;
                 distance[v] = newDistV;
                 pq.update(v);
             }
@@ -326,50 +330,48 @@ void TopHarmonicCloseness::bfsbound(node source) {
     auto &visited = visitedGlobal[omp_get_thread_num()];
     const auto ts = tsGlobal[omp_get_thread_num()];
     visited[source] = ts;
-    auto &nodesAtLevel = nodesAtLevelGlobal[omp_get_thread_num()];
-    nodesAtLevel.clear();
-    auto &nodesAtCurrentLevel = nodesAtCurrentLevelGlobal[omp_get_thread_num()];
-    nodesAtCurrentLevel.clear();
-    auto &numberOfNodesAtLevel = numberOfNodesAtLevelGlobal[omp_get_thread_num()];
+    // The nodes at distance i are stored at the positions [levelStart[i], levelStart[i + 1]).
+    auto &queue = queueGlobal[omp_get_thread_num()];
+    queue.clear();
+    queue.push_back(source);
+    auto &levelStart = levelStartGlobal[omp_get_thread_num()];
+    levelStart.clear();
+    levelStart.push_back(0);
 
-    for (count i = 1; i < numberOfNodesAtLevel.size() && numberOfNodesAtLevel[i] > 0; ++i)
-        numberOfNodesAtLevel[i] = 0;
-
-    assert(std::count_if(numberOfNodesAtLevel.begin(), numberOfNodesAtLevel.end(),
-                         [](count i) { return i > 0; })
-           == 0);
-
-    std::queue<node> q1, q2;
-    q1.push(source);
     count level = 1;
-    hCloseness[source] = 0;
+    index levelBegin = 0;
+    double h = 0;
 
     do {
-        do {
-            const node u = q1.front();
-            q1.pop();
-            nodesAtCurrentLevel.push_back(u);
-
-            G->forNeighborsOf(u, [&](node v) {
+        const index levelEnd = queue.size();
+        levelStart.push_back(levelEnd);
+        for (index i = levelBegin; i < levelEnd; ++i) {
+            G->forNeighborsOf(queue[i], [&](node v) {
                 if (visited[v] == ts)
                     return;
                 visited[v] = ts;
-                q2.push(v);
-                ++numberOfNodesAtLevel[level];
-                hCloseness[source] += 1. / static_cast<double>(level);
+                queue.push_back(v);
+                h += 1. / static_cast<double>(level);
             });
-        } while (!q1.empty());
+        }
 
-        nodesAtLevel.emplace_back(std::move(nodesAtCurrentLevel));
-        nodesAtCurrentLevel.clear();
         ++level;
-        std::swap(q1, q2);
-    } while (!q1.empty());
+        levelBegin = levelEnd;
+    } while (levelBegin < queue.size());
+
+    hCloseness[source] = h;
+
+    // Number of nodes at distance i >= 1 from the source.
+    const auto numberOfNodesAtLevel = [&](count i) -> count {
+        if (i == 0 || i + 1 >= levelStart.size())
+            return 0;
+        return levelStart[i + 1] - levelStart[i];
+    };
 
-    const double nearNodes = 1. + numberOfNodesAtLevel[1] + numberOfNodesAtLevel[2];
+    const double nearNodes = 1. + numberOfNodesAtLevel(1) + numberOfNodesAtLevel(2);
     double farNodes = 0;
     for (count i = 3; i < level; ++i)
-        farNodes += static_cast<double>(numberOfNodesAtLevel[i]) / static_cast<double>(i - 1);
+        farNodes += static_cast<double>(numberOfNodesAtLevel(i)) / static_cast<double>(i - 1);
 
     double levelBound = nearNodes / 2. + farNodes;
 
@@ -404,13 +406,13 @@ void TopHarmonicCloseness::bfsbound(node source) {
                 denominator = j - i > 2 ? static_cast<double>(j - i) : denominator;
             else
                 denominator = std::max(denominator, static_cast<double>(std::abs(j - i)));
-            levelBound += static_cast<double>(numberOfNodesAtLevel[j]) / denominator;
+            levelBound += static_cast<double>(numberOfNodesAtLevel(j)) / denominator;
         }
 
-        if (static_cast<size_t>(i) <= nodesAtLevel.size()) {
+        if (static_cast<size_t>(i) < levelStart.size()) {
             omp_set_lock(&lock);
-            for (node y : nodesAtLevel[i - 1])
-                updateBound(y);
+            for (index pos = levelStart[i - 1]; pos < levelStart[i]; ++pos)
+                updateBound(queue[pos]);
             omp_unset_lock(&lock);
         }
     }
@@ -5,18 +5,21 @@
  *      Author: cls
  */
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Parallelism.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/centrality/ApproxBetweenness.hpp>
 #include <networkit/centrality/ApproxCloseness.hpp>
 #include <networkit/centrality/ApproxElectricalCloseness.hpp>
 #include <networkit/centrality/ApproxSpanningEdge.hpp>
 #include <networkit/centrality/ApproxGroupBetweenness.hpp>
+#include <networkit/centrality/ApproxLocalClusteringCoefficient.hpp>
 #include <networkit/centrality/Betweenness.hpp>
 #include <networkit/centrality/Closeness.hpp>
 #include <networkit/centrality/CoreDecomposition.hpp>
@@ -1122,6 +1125,88 @@ TEST_F(CentralityGTest, testLocalClusteringCoefficientUndirected2) {
     EXPECT_EQ(reference, lccScores);
 }
 
+TEST_F(CentralityGTest, testApproxLocalClusteringCoefficient) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.3).generate();
+    // Add a few low-degree nodes which are evaluated exactly.
+    for (node u = 0; u < 20; ++u) {
+        const node v = G.addNode();
+        G.addEdge(v, u);
+        G.addEdge(v, u + 1);
+        G.addEdge(v, u + 2);
+    }
+
+    LocalClusteringCoefficient lcc(G);
+    lcc.run();
+    const auto &exact = lcc.scores();
+
+    const double epsilon = 0.05, delta = 0.1;
+    ApproxLocalClusteringCoefficient approx(G, epsilon, delta);
+    approx.run();
+    EXPECT_TRUE(approx.reachedErrorBound());
+
+    const auto &scores = approx.scores();
+    const auto &lower = approx.getLowerBounds();
+    const auto &upper = approx.getUpperBounds();
+    count violations = 0;
+    G.forNodes([&](node u) {
+        EXPECT_LE(lower[u], scores[u]);
+        EXPECT_LE(scores[u], upper[u]);
+        EXPECT_NEAR(scores[u], exact[u], 2 * epsilon);
+        if (G.degree(u) * (G.degree(u) - 1) / 2 < 100)
+            EXPECT_DOUBLE_EQ(scores[u], exact[u]);
+        if (exact[u] < lower[u] || exact[u] > upper[u])
+            ++violations;
+    });
+    EXPECT_LE(violations, delta * G.numberOfNodes());
+
+    const auto &classScores = approx.getDegreeClassScores();
+    const auto &classSizes = approx.getDegreeClassSizes();
+    ASSERT_EQ(classScores.size(),
+              ApproxLocalClusteringCoefficient::degreeClass(GraphTools::maxDegree(G)) + 1);
+    std::vector<double> expected(classScores.size(), 0.0);
+    G.forNodes([&](node u) {
+        expected[ApproxLocalClusteringCoefficient::degreeClass(G.degree(u))] += exact[u];
+    });
+    count totalSize = 0;
+    for (index c = 0; c < classScores.size(); ++c) {
+        totalSize += classSizes[c];
+        if (!classSizes[c])
+            continue;
+        const double width =
+            approx.getDegreeClassUpperBounds()[c] - approx.getDegreeClassLowerBounds()[c];
+        EXPECT_LE(width, 2 * epsilon);
+        EXPECT_NEAR(classScores[c], expected[c] / classSizes[c], width + 1e-9);
+    }
+    EXPECT_EQ(totalSize, G.numberOfNodes());
+}
+
+TEST_F(CentralityGTest, testApproxLocalClusteringCoefficientExact) {
+    // For a small error bound, all nodes of this small graph have fewer wedges than samples are
+    // needed; hence, they are evaluated exactly.
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(50, 0.2).generate();
+
+    LocalClusteringCoefficient lcc(G);
+    lcc.run();
+
+    ApproxLocalClusteringCoefficient approx(G, 0.02, 0.1);
+    approx.run();
+    count wedges = 0;
+    G.forNodes([&](node u) {
+        EXPECT_DOUBLE_EQ(approx.scores()[u], lcc.scores()[u]);
+        EXPECT_DOUBLE_EQ(approx.getLowerBounds()[u], approx.getUpperBounds()[u]);
+        wedges += G.degree(u) * (G.degree(u) - 1) / 2;
+    });
+    EXPECT_TRUE(approx.reachedErrorBound());
+    EXPECT_EQ(approx.numberOfSamples(), wedges);
+
+    Graph H(2);
+    H.addEdge(0, 1);
+    H.addEdge(1, 1);
+    EXPECT_ANY_THROW(ApproxLocalClusteringCoefficient(H, 0.1, 0.1));
+}
+
 TEST_F(CentralityGTest, testSimplePermanence) {
     Graph G(15, false, false);
     G.addEdge(0, 1);
@@ -1244,6 +1329,97 @@ TEST_P(CentralityGTest, testTopHarmonicCloseness) {
     }
 }
 
+TEST_P(CentralityGTest, testTopClosenessParallelWithTies) {
+    // In a grid, the nodes at symmetric positions have equal scores, so the k-th score is tied.
+    constexpr count side = 12;
+    Graph G(side * side, isWeighted(), isDirected());
+    const edgeweight w = isWeighted() ? 2.0 : defaultEdgeWeight;
+    for (node r = 0; r < side; ++r) {
+        for (node c = 0; c < side; ++c) {
+            const node u = r * side + c;
+            for (const node v : {u + 1, u + side}) {
+                if ((v == u + 1 && c + 1 == side) || v >= side * side)
+                    continue;
+                G.addEdge(u, v, w);
+                if (isDirected())
+                    G.addEdge(v, u, w);
+            }
+        }
+    }
+
+    const int maxThreads = Aux::getMaxNumberOfThreads();
+    Aux::setNumberOfThreads(4);
+
+    Closeness cc(G, true, ClosenessVariant::generalized);
+    cc.run();
+    const auto closeness = cc.scores();
+    const auto closenessRanking = cc.ranking();
+    HarmonicCloseness hc(G, false);
+    hc.run();
+    const auto harmonic = hc.scores();
+    const auto harmonicRanking = hc.ranking();
+    const double tol = 1e-9;
+
+    for (count k : {1, 6, 10}) {
+        // Farness values are sums of integers, hence ties are exact.
+        const double kth = closenessRanking[k - 1].second;
+        std::vector<node> expected;
+        G.forNodes([&](node u) {
+            if (closeness[u] >= kth)
+                expected.push_back(u);
+        });
+
+        // TopCloseness only supports unweighted graphs.
+        for (bool firstHeu : {true, false}) {
+            if (isWeighted())
+                break;
+            for (bool secHeu : {true, false}) {
+                TopCloseness topcc(G, k, firstHeu, secHeu);
+                topcc.run();
+                EXPECT_EQ(topcc.topkNodesList().size(), k);
+
+                // All nodes tied with the k-th are in the trail; ties are ordered by id.
+                const auto nodes = topcc.topkNodesList(true);
+                const auto scores = topcc.topkScoresList(true);
+                ASSERT_EQ(nodes.size(), expected.size());
+                for (count i = 0; i < nodes.size(); ++i) {
+                    EXPECT_DOUBLE_EQ(scores[i], closenessRanking[i].second);
+                    EXPECT_DOUBLE_EQ(scores[i], closeness[nodes[i]]);
+                    if (i > 0 && scores[i] == scores[i - 1])
+                        EXPECT_LT(nodes[i - 1], nodes[i]);
+                }
+                std::vector<node> sorted(nodes);
+                std::sort(sorted.begin(), sorted.end());
+                EXPECT_EQ(sorted, expected);
+            }
+        }
+
+        for (bool useNBbound : {true, false}) {
+            if (isWeighted() && useNBbound)
+                continue;
+            TopHarmonicCloseness topcc(G, k, useNBbound);
+            topcc.run();
+            EXPECT_EQ(topcc.topkNodesList().size(), k);
+
+            // Harmonic sums may differ in the last bits between tied nodes.
+            const auto nodes = topcc.topkNodesList(true);
+            const auto scores = topcc.topkScoresList(true);
+            ASSERT_GE(nodes.size(), k);
+            for (count i = 0; i < nodes.size(); ++i) {
+                EXPECT_NEAR(scores[i], harmonicRanking[i].second, tol);
+                EXPECT_NEAR(scores[i], harmonic[nodes[i]], tol);
+            }
+            const double kthHarmonic = harmonicRanking[k - 1].second;
+            G.forNodes([&](node u) {
+                if (harmonic[u] > kthHarmonic + tol)
+                    EXPECT_NE(std::find(nodes.begin(), nodes.end(), u), nodes.end());
+            });
+        }
+    }
+
+    Aux::setNumberOfThreads(maxThreads);
+}
+
 TEST_F(CentralityGTest, testLaplacianCentrality) {
     // The graph structure and reference values for the scores are taken from
     // Qi et al., Laplacian centrality: A new centrality measure for weighted
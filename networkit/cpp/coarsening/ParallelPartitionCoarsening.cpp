@@ -5,20 +5,20 @@
  *      Author: cls
  */
 
+#include <limits>
 #include <numeric>
-#include <omp.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/SparseVector.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
-#include <networkit/graph/GraphBuilder.hpp>
 
 namespace NetworKit {
 
 ParallelPartitionCoarsening::ParallelPartitionCoarsening(const Graph &G,
                                                          const Partition &zeta,
-                                                         bool useGraphBuilder)
-    : GraphCoarsening(G), zeta(zeta), useGraphBuilder(useGraphBuilder) {}
+                                                         bool)
+    : GraphCoarsening(G), zeta(zeta) {}
 
 void ParallelPartitionCoarsening::run() {
     Aux::Timer timer;
@@ -29,109 +29,74 @@ void ParallelPartitionCoarsening::run() {
         (zeta.upperBound() <=
          G->upperNodeIdBound())); // use turbo if the upper id bound is <= number
                                  // of nodes
-    count nextNodeId = nodeToSuperNode.upperBound();
-
-    Graph Gcombined;
-    if (!useGraphBuilder) {
-        Graph Ginit(nextNodeId, true); // initial graph containing supernodes
-
-        // make copies of initial graph
-        count nThreads = omp_get_max_threads();
-        std::vector<Graph> localGraphs(nThreads, Ginit); // thread-local graphs
-
-        // iterate over edges of G and create edges in coarse graph or update edge
-        // and node weights in Gcon
-        DEBUG("create edges in coarse graphs");
-        G->parallelForEdges([&](node u, node v, edgeweight ew) {
-            index t = omp_get_thread_num();
-
-            node su = nodeToSuperNode[u];
-            node sv = nodeToSuperNode[v];
-            localGraphs.at(t).increaseWeight(su, sv, ew);
-        });
-
-        Aux::Timer timer2;
-        timer2.start();
-        // combine local graphs in parallel
-        // Graph Gcombined(Ginit.numberOfNodes(), true); //
-        Gcombined = Graph(Ginit.numberOfNodes(), true);
+    nodeMapping = nodeToSuperNode.getVector();
+    Gcoarsened = contract(*G, nodeMapping, nodeToSuperNode.upperBound());
 
-        std::vector<count> numEdges(nThreads);
+    timer.stop();
+    INFO("parallel coarsening took ", timer.elapsedTag());
+    hasRun = true;
+}
 
-        // access internals of Graph to write adjacencies
-        auto threadSafeIncreaseWeight = [&](node u, node v, edgeweight ew) {
-            index vi = Gcombined.indexInOutEdgeArray(u, v);
-            if (vi == none) {
-                index t = omp_get_thread_num();
-                if (u == v) {
-                    numEdges[t] += 2;
-                } else {
-                    numEdges[t] += 1; // normal edges count half
-                }
-                Gcombined.outEdges[u].push_back(v);
-                Gcombined.outEdgeWeights[u].push_back(ew);
-            } else {
-                Gcombined.outEdgeWeights[u][vi] += ew;
-            }
-        };
+Graph ParallelPartitionCoarsening::contract(const Graph &G,
+                                            const std::vector<node> &nodeToSuperNode,
+                                            count numberOfSuperNodes, bool noSelfLoops) {
+    // bucket the fine nodes by their supernode (counting sort)
+    std::vector<index> offsets(numberOfSuperNodes + 1, 0);
+    G.forNodes([&](node u) { ++offsets[nodeToSuperNode[u] + 1]; });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<node> members(offsets.back());
+    {
+        std::vector<index> next(offsets.begin(), offsets.end() - 1);
+        G.forNodes([&](node u) { members[next[nodeToSuperNode[u]]++] = u; });
+    }
 
-        DEBUG("combining graphs");
-        Gcombined.balancedParallelForNodes([&](node u) {
-            for (index l = 0; l < nThreads; ++l) {
-                localGraphs.at(l).forEdgesOf(u, [&](node u, node v, edgeweight w) {
-                    TRACE("increasing weight of (", u, v, ") to", w);
-                    threadSafeIncreaseWeight(u, v, w);
+    // every thread aggregates the edges of whole supernodes and writes their adjacencies directly
+    Graph Gcoarse(numberOfSuperNodes, true);
+    count numEdges = 0; // edges between supernodes are counted twice
+    count numSelfLoops = 0;
+#pragma omp parallel reduction(+ : numEdges, numSelfLoops)
+    {
+        Aux::SparseVector<edgeweight> outWeights(numberOfSuperNodes,
+                                                 -std::numeric_limits<edgeweight>::infinity());
+
+#pragma omp for schedule(guided)
+        for (omp_index su = 0; su < static_cast<omp_index>(numberOfSuperNodes); ++su) {
+            for (index i = offsets[su]; i < offsets[su + 1]; ++i) {
+                const node u = members[i];
+                G.forNeighborsOf(u, [&](node v, edgeweight ew) {
+                    const node sv = nodeToSuperNode[v];
+                    // edges inside su are visited from both endpoints, count them only once
+                    if (sv == static_cast<node>(su) && (noSelfLoops || u < v))
+                        return;
+                    if (outWeights.indexIsUsed(sv))
+                        outWeights[sv] += ew;
+                    else
+                        outWeights.insert(sv, ew);
                 });
             }
-        });
 
-        // ensure consistency of data structure
-        DEBUG("numEdges: ", numEdges);
-        count twiceM = std::accumulate(numEdges.begin(), numEdges.end(), count{0});
-        assert(twiceM % 2 == 0);
-        Gcombined.m = (twiceM / 2);
-
-        assert(Gcombined.checkConsistency());
-
-        // stop both timers before printing
-        timer2.stop();
-        INFO("combining coarse graphs took ", timer2.elapsedTag());
-    } else {
-        std::vector<std::vector<node>> nodesPerSuperNode(nextNodeId);
-        G->forNodes([&](node v) {
-            node sv = nodeToSuperNode[v];
-            nodesPerSuperNode[sv].push_back(v);
-        });
-
-        // iterate over edges of G and create edges in coarse graph or update edge
-        // and node weights in Gcon
-        DEBUG("create edges in coarse graphs");
-        GraphBuilder b(nextNodeId, true, false);
-#pragma omp parallel for schedule(guided)
-        for (omp_index su = 0; su < static_cast<omp_index>(nextNodeId); su++) {
-            std::map<index, edgeweight> outEdges;
-            for (node u : nodesPerSuperNode[su]) {
-                G->forNeighborsOf(u, [&](node v, edgeweight ew) {
-                    node sv = nodeToSuperNode[v];
-                    if (su != sv || u >= v) { // count edges inside uv only once (we
-                                                // iterate over them twice)
-                        outEdges[sv] += ew;
-                    }
-                });
-            }
-            for (auto it : outEdges) {
-                b.addHalfEdge(su, it.first, it.second);
-            }
+            auto &adjacency = Gcoarse.outEdges[su];
+            auto &weights = Gcoarse.outEdgeWeights[su];
+            adjacency.reserve(outWeights.size());
+            weights.reserve(outWeights.size());
+            outWeights.forElements([&](node sv, edgeweight w) {
+                adjacency.push_back(sv);
+                weights.push_back(w);
+                if (sv == static_cast<node>(su))
+                    ++numSelfLoops;
+                else
+                    ++numEdges;
+            });
+            outWeights.reset();
         }
-
-        Gcombined = b.toGraph(false);
     }
 
-    timer.stop();
-    INFO("parallel coarsening took ", timer.elapsedTag());
-    Gcoarsened = std::move(Gcombined);
-    nodeMapping = nodeToSuperNode.getVector();
-    hasRun = true;
+    assert(numEdges % 2 == 0);
+    Gcoarse.m = numEdges / 2 + numSelfLoops;
+    Gcoarse.storedNumberOfSelfLoops = numSelfLoops;
+    assert(Gcoarse.checkConsistency());
+
+    return Gcoarse;
 }
 
 } /* namespace NetworKit */
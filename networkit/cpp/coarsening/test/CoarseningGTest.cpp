@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
 #include <networkit/coarsening/ClusteringProjector.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
@@ -229,6 +230,54 @@ TEST_F(CoarseningGTest, testParallelPartitionCoarseningOnRealGraphWithGraphBuild
     });
 }
 
+TEST_F(CoarseningGTest, testContractAgainstBruteForce) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.05).generate();
+    G.forNodes([&](node u) {
+        if (u % 7 == 0)
+            G.addEdge(u, u);
+    });
+    G.removeNode(3);
+
+    // random partition into 20 subsets, subset 0 is much larger than the others
+    const count k = 20;
+    std::vector<node> nodeToSuperNode(G.upperNodeIdBound(), none);
+    G.forNodes([&](node u) {
+        nodeToSuperNode[u] = Aux::Random::probability() < 0.3 ? 0 : Aux::Random::integer(k - 1);
+    });
+
+    for (bool noSelfLoops : {false, true}) {
+        Graph coarse = ParallelPartitionCoarsening::contract(G, nodeToSuperNode, k, noSelfLoops);
+        EXPECT_TRUE(coarse.checkConsistency());
+        EXPECT_EQ(coarse.numberOfNodes(), k);
+
+        std::vector<std::vector<edgeweight>> expected(k, std::vector<edgeweight>(k, 0));
+        G.forEdges([&](node u, node v, edgeweight ew) {
+            const node su = nodeToSuperNode[u], sv = nodeToSuperNode[v];
+            if (su == sv && noSelfLoops)
+                return;
+            expected[su][sv] += ew;
+            if (su != sv)
+                expected[sv][su] += ew;
+        });
+
+        count expectedEdges = 0, expectedSelfLoops = 0;
+        for (node su = 0; su < k; ++su) {
+            for (node sv = su; sv < k; ++sv) {
+                EXPECT_EQ(coarse.weight(su, sv), expected[su][sv]);
+                if (expected[su][sv] > 0) {
+                    ++expectedEdges;
+                    expectedSelfLoops += su == sv;
+                }
+            }
+        }
+        EXPECT_EQ(coarse.numberOfEdges(), expectedEdges);
+        EXPECT_EQ(coarse.numberOfSelfLoops(), expectedSelfLoops);
+        if (!noSelfLoops)
+            EXPECT_EQ(coarse.totalEdgeWeight(), G.totalEdgeWeight());
+    }
+}
+
 TEST_F(CoarseningGTest, testMatchingContractor) {
     METISGraphReader reader;
     Graph G = reader.read("input/celegans_metabolic.graph");
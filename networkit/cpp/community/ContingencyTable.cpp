@@ -0,0 +1,134 @@
+/*
+ * ContingencyTable.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include <networkit/community/ContingencyTable.hpp>
+
+namespace NetworKit {
+
+ContingencyTable::ContingencyTable(const Graph &G, const Partition &zeta, const Partition &eta) {
+    build(zeta, eta, G.upperNodeIdBound(),
+          [&](node u) { return G.hasNode(u) && zeta.contains(u) && eta.contains(u); });
+}
+
+ContingencyTable::ContingencyTable(const Partition &zeta, const Partition &eta) {
+    build(zeta, eta, std::max(zeta.numberOfElements(), eta.numberOfElements()),
+          [&](index e) { return zeta.contains(e) && eta.contains(e); });
+}
+
+template <typename ElementFilter>
+void ContingencyTable::build(const Partition &zeta, const Partition &eta, count bound,
+                             ElementFilter counted) {
+    const index upperFirst = zeta.upperBound(), upperSecond = eta.upperBound();
+
+    // Counting sort of the elements by their subset in zeta.
+    std::unique_ptr<std::atomic<index>[]> next(new std::atomic<index>[upperFirst] {});
+    std::unique_ptr<std::atomic<count>[]> second(new std::atomic<count>[upperSecond] {});
+#pragma omp parallel for
+    for (omp_index e = 0; e < static_cast<omp_index>(bound); ++e) {
+        if (!counted(e))
+            continue;
+        next[zeta[e]].fetch_add(1, std::memory_order_relaxed);
+        second[eta[e]].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    sizesFirst.resize(upperFirst);
+    std::vector<index> bucketOffsets(upperFirst + 1, 0);
+    for (index C = 0; C < upperFirst; ++C) {
+        sizesFirst[C] = next[C].load(std::memory_order_relaxed);
+        bucketOffsets[C + 1] = bucketOffsets[C] + sizesFirst[C];
+        next[C].store(bucketOffsets[C], std::memory_order_relaxed);
+    }
+    numElements = bucketOffsets[upperFirst];
+
+    sizesSecond.resize(upperSecond);
+#pragma omp parallel for
+    for (omp_index D = 0; D < static_cast<omp_index>(upperSecond); ++D)
+        sizesSecond[D] = second[D].load(std::memory_order_relaxed);
+
+    // The bucket of C holds the subsets in eta of the elements of C.
+    std::vector<index> buckets(numElements);
+#pragma omp parallel for
+    for (omp_index e = 0; e < static_cast<omp_index>(bound); ++e)
+        if (counted(e))
+            buckets[next[zeta[e]].fetch_add(1, std::memory_order_relaxed)] = eta[e];
+
+    // Sort every bucket and count its distinct subsets, which become the entries of C.
+    std::vector<index> entryOffsets(upperFirst + 1, 0);
+#pragma omp parallel for schedule(dynamic, 16)
+    for (omp_index C = 0; C < static_cast<omp_index>(upperFirst); ++C) {
+        const auto begin = buckets.begin() + bucketOffsets[C];
+        const auto end = buckets.begin() + bucketOffsets[C + 1];
+        if (begin == end)
+            continue;
+        std::sort(begin, end);
+        count distinct = 1;
+        for (auto it = begin + 1; it != end; ++it)
+            distinct += *it != *(it - 1);
+        entryOffsets[C + 1] = distinct;
+    }
+    for (index C = 0; C < upperFirst; ++C)
+        entryOffsets[C + 1] += entryOffsets[C];
+
+    const count numEntries = entryOffsets[upperFirst];
+    firstSubsets.resize(numEntries);
+    secondSubsets.resize(numEntries);
+    entrySizes.resize(numEntries);
+#pragma omp parallel for schedule(dynamic, 16)
+    for (omp_index C = 0; C < static_cast<omp_index>(upperFirst); ++C) {
+        index i = entryOffsets[C];
+        for (index j = bucketOffsets[C], k = j; j < bucketOffsets[C + 1]; j = k) {
+            while (k < bucketOffsets[C + 1] && buckets[k] == buckets[j])
+                ++k;
+            firstSubsets[i] = static_cast<index>(C);
+            secondSubsets[i] = buckets[j];
+            entrySizes[i] = k - j;
+            ++i;
+        }
+    }
+
+    entry.assign(bound, none);
+#pragma omp parallel for
+    for (omp_index e = 0; e < static_cast<omp_index>(bound); ++e) {
+        if (!counted(e))
+            continue;
+        const index C = zeta[e];
+        const auto begin = secondSubsets.begin() + entryOffsets[C];
+        const auto end = secondSubsets.begin() + entryOffsets[C + 1];
+        entry[e] = std::lower_bound(begin, end, eta[e]) - secondSubsets.begin();
+    }
+}
+
+namespace {
+
+count sumOfPairs(const std::vector<count> &sizes) {
+    count sum = 0;
+#pragma omp parallel for reduction(+ : sum)
+    for (omp_index i = 0; i < static_cast<omp_index>(sizes.size()); ++i)
+        sum += sizes[i] * (sizes[i] - 1) / 2;
+    return sum;
+}
+
+} // namespace
+
+count ContingencyTable::pairsInEntries() const {
+    return sumOfPairs(entrySizes);
+}
+
+count ContingencyTable::pairsInFirst() const {
+    return sumOfPairs(sizesFirst);
+}
+
+count ContingencyTable::pairsInSecond() const {
+    return sumOfPairs(sizesSecond);
+}
+
+} // namespace NetworKit
@@ -1,6 +1,7 @@
 
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/community/CoverF1Similarity.hpp>
+#include <networkit/structures/CompactCover.hpp>
 
 namespace NetworKit {
 
@@ -10,24 +11,10 @@ void CoverF1Similarity::run() {
     hasRun = false;
     Aux::SignalHandler handler;
 
-    std::vector<std::vector<node>> Csets(C->upperBound());
-    std::vector<count> referenceSizes(reference->upperBound(), 0);
-    count numMemberships = 0;
-
-    handler.assureRunning();
-
-    // Calculate cluster sizes and explicitly store all clusters of C
-    G->forNodes([&](node u) {
-        for (index c : (*C)[u]) {
-            Csets[c].push_back(u);
-        }
-
-        for (index c : (*reference)[u]) {
-            ++referenceSizes[c];
-        }
-
-        numMemberships += (*C)[u].size();
-    });
+    // Explicitly store all clusters of C and the reference
+    const CompactCover Csets(*C);
+    const CompactCover referenceSets(*reference);
+    const count numMemberships = Csets.numberOfMemberships();
 
     handler.assureRunning();
 
@@ -47,10 +34,10 @@ void CoverF1Similarity::run() {
     std::vector<index> overlappingReference;
 
     for (index i = 0; i < C->upperBound(); ++i) {
-        if (!Csets[i].empty()) {
+        if (Csets.subsetSize(i) > 0) {
             ++numClusters;
 
-            for (node u : Csets[i]) {
+            Csets.forMembersOf(i, [&](node u) {
                 for (index s : (*reference)[u]) {
                     if (overlap[s] == 0) {
                         overlappingReference.push_back(s);
@@ -58,7 +45,7 @@ void CoverF1Similarity::run() {
 
                     ++overlap[s];
                 }
-            }
+            });
 
             double bestF1 = 0;
 
@@ -69,8 +56,8 @@ void CoverF1Similarity::run() {
                 // Reset values
                 overlap[s] = 0;
 
-                double precision = ol * 1.0 / referenceSizes[s];
-                double recall = ol * 1.0 / Csets[i].size();
+                double precision = ol * 1.0 / referenceSets.subsetSize(s);
+                double recall = ol * 1.0 / Csets.subsetSize(i);
 
                 double f1 = 2 * (precision * recall) / (precision + recall);
                 if (f1 > bestF1) {
@@ -84,7 +71,7 @@ void CoverF1Similarity::run() {
             minimumValue = std::min(bestF1, minimumValue);
             maximumValue = std::max(bestF1, maximumValue);
             unweightedAverage += bestF1;
-            weightedAverage += bestF1 * Csets[i].size();
+            weightedAverage += bestF1 * Csets.subsetSize(i);
         }
     }
 
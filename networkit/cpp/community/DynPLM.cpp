@@ -0,0 +1,421 @@
+/*
+ * DynPLM.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <omp.h>
+#include <sstream>
+#include <string>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/community/DynPLM.hpp>
+#include <networkit/community/PLM.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Affinities are non-negative sums, hence -infinity marks unused entries.
+constexpr edgeweight noAffinity = -std::numeric_limits<edgeweight>::infinity();
+
+// Grows the sparse vector geometrically such that it can hold the indices [0, size).
+void ensureSize(Aux::SparseVector<edgeweight> &vector, count size) {
+    if (vector.upperBound() < size)
+        vector.resize(std::max<count>(size, 2 * vector.upperBound()), noAffinity);
+}
+
+} // namespace
+
+DynPLM::DynPLM(const Graph &G, double gamma, bool refine, count maxIter)
+    : CommunityDetectionAlgorithm(G), gamma(gamma), refine(refine), maxIter(maxIter) {
+    if (G.isDirected())
+        throw std::runtime_error("DynPLM is not implemented for directed graphs");
+}
+
+void DynPLM::run() {
+    PLM plm(*G, refine, gamma, "balanced", maxIter);
+    plm.run();
+    result = plm.getPartition();
+    initialize();
+    visitedNodes = 0;
+    hasRun = true;
+}
+
+void DynPLM::initialize() {
+    const count z = G->upperNodeIdBound();
+    for (node u = 0; u < z; ++u)
+        if (!G->hasNode(u))
+            result[u] = none;
+    result.compact(true);
+    const count k = result.upperBound();
+
+    volNode.assign(z, 0.0);
+    G->parallelForNodes([&](node u) { volNode[u] = G->weightedDegree(u, true); });
+
+    volCommunity.assign(k, 0.0);
+    members.assign(k, {});
+    listedIn.assign(z, none);
+    position.assign(z, none);
+    totalVolume = 0;
+    G->forNodes([&](node u) {
+        volCommunity[result[u]] += volNode[u];
+        totalVolume += volNode[u];
+        addMember(u, result[u]);
+    });
+
+    nodeAffinity.assign(omp_get_max_threads(), Aux::SparseVector<edgeweight>());
+    communityAffinity = Aux::SparseVector<edgeweight>(k, noAffinity);
+    communityQueued.assign(k, 0);
+    freeCommunities.clear();
+}
+
+void DynPLM::addMember(node u, index c) {
+    listedIn[u] = c;
+    position[u] = members[c].size();
+    members[c].push_back(u);
+}
+
+void DynPLM::removeMember(node u) {
+    auto &list = members[listedIn[u]];
+    const node last = list.back();
+    list[position[u]] = last;
+    position[last] = position[u];
+    list.pop_back();
+    listedIn[u] = none;
+    position[u] = none;
+}
+
+void DynPLM::releaseIfEmpty(index c) {
+    if (members[c].empty()) {
+        volCommunity[c] = 0;
+        freeCommunities.push_back(c);
+    }
+}
+
+index DynPLM::newCommunity() {
+    if (!freeCommunities.empty()) {
+        const index c = freeCommunities.back();
+        freeCommunities.pop_back();
+        return c;
+    }
+    const index c = result.upperBound();
+    result.setUpperBound(c + 1);
+    volCommunity.push_back(0.0);
+    members.emplace_back();
+    communityQueued.push_back(0);
+    return c;
+}
+
+void DynPLM::update(GraphEvent e) {
+    updateBatch({e});
+}
+
+void DynPLM::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+
+    std::vector<node> endpoints;
+    for (const GraphEvent &e : batch) {
+        switch (e.type) {
+        case GraphEvent::NODE_ADDITION:
+        case GraphEvent::NODE_REMOVAL:
+        case GraphEvent::NODE_RESTORATION:
+        case GraphEvent::TIME_STEP:
+            break;
+        case GraphEvent::EDGE_ADDITION:
+        case GraphEvent::EDGE_REMOVAL:
+        case GraphEvent::EDGE_WEIGHT_UPDATE:
+        case GraphEvent::EDGE_WEIGHT_INCREMENT:
+            endpoints.push_back(e.u);
+            endpoints.push_back(e.v);
+            break;
+        default:
+            throw std::runtime_error("Event type not supported by DynPLM");
+        }
+    }
+    std::sort(endpoints.begin(), endpoints.end());
+    endpoints.erase(std::unique(endpoints.begin(), endpoints.end()), endpoints.end());
+
+    // Graph::removeNode drops the edges of the node without events, so the volumes of its
+    // neighbors would go stale; hence, the edges have to be removed by events first.
+    for (const GraphEvent &e : batch) {
+        if (e.type == GraphEvent::NODE_REMOVAL && e.u < volNode.size() && volNode[e.u] != 0
+            && !std::binary_search(endpoints.begin(), endpoints.end(), e.u))
+            throw std::runtime_error("DynPLM requires EDGE_REMOVAL events for the edges of node "
+                                     + std::to_string(e.u) + " before its removal");
+    }
+
+    const count oldZ = result.numberOfElements();
+    const count z = G->upperNodeIdBound();
+    while (result.numberOfElements() < z)
+        result.extend();
+    volNode.resize(z, 0.0);
+    listedIn.resize(z, none);
+    position.resize(z, none);
+
+    for (const GraphEvent &e : batch) {
+        if (e.type == GraphEvent::NODE_RESTORATION) {
+            if (G->hasNode(e.u) && result[e.u] == none) {
+                const index c = newCommunity();
+                result[e.u] = c;
+                addMember(e.u, c);
+            }
+        } else if (e.type == GraphEvent::NODE_REMOVAL && result[e.u] != none) {
+            // The neighbors are endpoints of the removed edges and get their volumes below.
+            const index c = result[e.u];
+            volCommunity[c] -= volNode[e.u];
+            totalVolume -= volNode[e.u];
+            volNode[e.u] = 0;
+            removeMember(e.u);
+            result[e.u] = none;
+            releaseIfEmpty(c);
+        }
+        // Like GraphUpdater, do not rely on the node of NODE_ADDITION events; added nodes are
+        // assigned below.
+    }
+
+    // Every added node that still exists starts in a singleton community.
+    for (node u = oldZ; u < z; ++u) {
+        if (G->hasNode(u) && result[u] == none) {
+            result[u] = newCommunity();
+            addMember(u, result[u]);
+        }
+    }
+
+    endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(),
+                                   [&](node u) { return !G->hasNode(u); }),
+                    endpoints.end());
+
+    // The volumes only change at the endpoints of the changed edges.
+    std::vector<index> affected;
+    affected.reserve(endpoints.size());
+    for (const node u : endpoints) {
+        if (result[u] == none) {
+            result[u] = newCommunity();
+            addMember(u, result[u]);
+        }
+        const double vol = G->weightedDegree(u, true);
+        volCommunity[result[u]] += vol - volNode[u];
+        totalVolume += vol - volNode[u];
+        volNode[u] = vol;
+        affected.push_back(result[u]);
+    }
+
+    visitedNodes = 0;
+    if (totalVolume <= 0)
+        return;
+
+    const std::vector<index> changed = moveNodes(std::move(endpoints));
+    affected.insert(affected.end(), changed.begin(), changed.end());
+    mergeCommunities(std::move(affected));
+}
+
+std::vector<index> DynPLM::moveNodes(std::vector<node> active) {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+    const count numThreads = nodeAffinity.size();
+    std::vector<std::vector<node>> nextActive(numThreads), moved(numThreads);
+    std::vector<std::vector<index>> changed(numThreads);
+
+    // The queue flags are reused across updates; all of them are false between updates.
+    if (queuedSize < z) {
+        queuedSize = std::max<count>(z, 2 * queuedSize);
+        queued.reset(new std::atomic<bool>[queuedSize] {});
+    }
+    for (const node u : active)
+        queued[u].store(true, std::memory_order_relaxed);
+
+    for (count round = 0; !active.empty() && round < maxIter; ++round) {
+        handler.assureRunning();
+        visitedNodes += active.size();
+
+#pragma omp parallel num_threads(static_cast<int>(numThreads))
+        {
+            const index tid = omp_get_thread_num();
+            auto &affinity = nodeAffinity[tid];
+            ensureSize(affinity, result.upperBound());
+
+#pragma omp for schedule(guided)
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+                const node u = active[i];
+                queued[u].store(false, std::memory_order_relaxed);
+
+                const index C = result[u];
+                affinity.insert(C, 0.0);
+                G->forNeighborsOf(u, [&](node v, edgeweight ew) {
+                    if (u == v)
+                        return;
+                    const index D = result[v];
+                    if (affinity.indexIsUsed(D))
+                        affinity[D] += ew;
+                    else
+                        affinity.insert(D, ew);
+                });
+
+                const double volU = volNode[u];
+                double volC;
+#pragma omp atomic read
+                volC = volCommunity[C];
+                volC -= volU;
+
+                index best = none;
+                double bestGain = 0;
+                for (const index D : affinity.usedIndices()) {
+                    if (D == C)
+                        continue;
+                    double volD;
+#pragma omp atomic read
+                    volD = volCommunity[D];
+                    const double gain =
+                        affinity[D] - affinity[C] - gamma * volU * (volD - volC) / totalVolume;
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        best = D;
+                    }
+                }
+                affinity.reset();
+
+                if (best == none)
+                    continue;
+
+                result[u] = best;
+#pragma omp atomic
+                volCommunity[C] -= volU;
+#pragma omp atomic
+                volCommunity[best] += volU;
+                moved[tid].push_back(u);
+                changed[tid].push_back(C);
+                changed[tid].push_back(best);
+
+                G->forNeighborsOf(u, [&](node v) {
+                    if (result[v] != best && !queued[v].exchange(true, std::memory_order_relaxed))
+                        nextActive[tid].push_back(v);
+                });
+            }
+        }
+
+        active.clear();
+        for (auto &next : nextActive) {
+            active.insert(active.end(), next.begin(), next.end());
+            next.clear();
+        }
+    }
+
+    for (const node u : active)
+        queued[u].store(false, std::memory_order_relaxed);
+
+    // Update the member lists of the moved nodes; a node may have moved several times.
+    std::vector<index> left;
+    for (const auto &threadMoved : moved) {
+        for (const node u : threadMoved) {
+            if (listedIn[u] != none && listedIn[u] != result[u]) {
+                left.push_back(listedIn[u]);
+                removeMember(u);
+            }
+        }
+    }
+    for (const auto &threadMoved : moved)
+        for (const node u : threadMoved)
+            if (listedIn[u] == none)
+                addMember(u, result[u]);
+
+    std::sort(left.begin(), left.end());
+    left.erase(std::unique(left.begin(), left.end()), left.end());
+    for (const index c : left)
+        releaseIfEmpty(c);
+
+    std::vector<index> changedCommunities;
+    for (const auto &threadChanged : changed)
+        changedCommunities.insert(changedCommunities.end(), threadChanged.begin(),
+                                  threadChanged.end());
+    return changedCommunities;
+}
+
+void DynPLM::mergeCommunities(std::vector<index> affected) {
+    ensureSize(communityAffinity, result.upperBound());
+
+    std::vector<index> queue, next;
+    for (const index c : affected) {
+        if (!communityQueued[c]) {
+            communityQueued[c] = 1;
+            queue.push_back(c);
+        }
+    }
+
+    for (count round = 0; !queue.empty() && round < maxIter; ++round) {
+        for (const index C : queue) {
+            communityQueued[C] = 0;
+            if (members[C].empty())
+                continue;
+
+            for (const node u : members[C]) {
+                G->forNeighborsOf(u, [&](node v, edgeweight ew) {
+                    const index D = result[v];
+                    if (D == C)
+                        return;
+                    if (communityAffinity.indexIsUsed(D))
+                        communityAffinity[D] += ew;
+                    else
+                        communityAffinity.insert(D, ew);
+                });
+            }
+
+            // Merging C and D changes the modularity by (w(C, D) - gamma vol(C) vol(D) / 2m) / m.
+            index best = none;
+            double bestGain = 0;
+            communityAffinity.forElements([&](index D, edgeweight w) {
+                const double gain = w - gamma * volCommunity[C] * volCommunity[D] / totalVolume;
+                if (gain > bestGain) {
+                    bestGain = gain;
+                    best = D;
+                }
+            });
+            communityAffinity.reset();
+
+            if (best == none)
+                continue;
+
+            // Relabel the smaller community.
+            index from = C, to = best;
+            if (members[from].size() > members[to].size())
+                std::swap(from, to);
+            for (const node u : members[from]) {
+                result[u] = to;
+                listedIn[u] = to;
+                position[u] = members[to].size();
+                members[to].push_back(u);
+            }
+            members[from].clear();
+            volCommunity[to] += volCommunity[from];
+            releaseIfEmpty(from);
+
+            if (!communityQueued[to]) {
+                communityQueued[to] = 1;
+                next.push_back(to);
+            }
+        }
+        std::swap(queue, next);
+        next.clear();
+    }
+
+    for (const index c : queue)
+        communityQueued[c] = 0;
+}
+
+std::string DynPLM::toString() const {
+    std::stringstream stream;
+    stream << "DynPLM(gamma=" << gamma;
+    if (refine)
+        stream << ",refine";
+    stream << ")";
+    return stream.str();
+}
+
+} // namespace NetworKit
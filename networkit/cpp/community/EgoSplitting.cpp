@@ -0,0 +1,134 @@
+/*
+ * EgoSplitting.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/SortedIntersection.hpp>
+#include <networkit/community/EgoSplitting.hpp>
+#include <networkit/community/PLM.hpp>
+#include <networkit/community/PLP.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
+#include <networkit/graph/SortedAdjacency.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Returns a compact partition of H; graphs without edges are partitioned into singletons.
+Partition clusterGraph(const Graph &H, EgoSplitting::Clustering algorithm) {
+    Partition zeta;
+    if (H.numberOfEdges() == 0) {
+        zeta = Partition(H.upperNodeIdBound());
+        zeta.allToSingletons();
+    } else if (algorithm == EgoSplitting::Clustering::PLP) {
+        PLP plp(H);
+        plp.run();
+        zeta = plp.getPartition();
+    } else {
+        PLM plm(H);
+        plm.run();
+        zeta = plm.getPartition();
+    }
+    zeta.compact(true);
+    return zeta;
+}
+
+} // namespace
+
+EgoSplitting::EgoSplitting(const Graph &G, Clustering localClustering, Clustering globalClustering)
+    : G(&G), localClustering(localClustering), globalClustering(globalClustering) {
+    if (G.isDirected())
+        throw std::runtime_error("EgoSplitting is not implemented for directed graphs");
+    if (G.numberOfSelfLoops())
+        throw std::runtime_error("EgoSplitting does not support graphs with self-loops. Call "
+                                 "Graph.removeSelfLoops() first.");
+}
+
+void EgoSplitting::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+    const SortedAdjacency adjacency(*G);
+
+    // The local community of the i-th neighbor of u is stored at adjacency.offset(u) + i.
+    std::vector<index> localCommunity(adjacency.numberOfEntries(), 0);
+    std::vector<index> personaOffset(z + 1, 0);
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+        const node u = static_cast<node>(i);
+        if (!G->hasNode(u))
+            continue;
+        const count deg = adjacency.degree(u);
+        if (deg <= 1) {
+            // Isolated nodes keep one persona such that they show up in the cover.
+            personaOffset[u + 1] = 1;
+            continue;
+        }
+
+        // The ego-net of u; the j-th neighbor of u becomes node j.
+        const node *neighbors = adjacency.neighbors(u);
+        Graph egoNet(deg);
+        for (index j = 0; j < deg; ++j) {
+            const node v = neighbors[j];
+            Aux::SortedIntersection::forIntersection(
+                neighbors, deg, adjacency.neighbors(v), adjacency.degree(v),
+                [&](size_t k, size_t) {
+                    if (k > j)
+                        egoNet.addEdge(j, k);
+                });
+        }
+
+        const Partition local = clusterGraph(egoNet, localClustering);
+        for (index j = 0; j < deg; ++j)
+            localCommunity[adjacency.offset(u) + j] = local[j];
+        personaOffset[u + 1] = local.upperBound();
+    }
+
+    handler.assureRunning();
+
+    for (node u = 0; u < z; ++u)
+        personaOffset[u + 1] += personaOffset[u];
+    const count numPersonas = personaOffset[z];
+
+    personaNode.assign(numPersonas, none);
+    G->parallelForNodes([&](node u) {
+        std::fill(personaNode.begin() + personaOffset[u],
+                  personaNode.begin() + personaOffset[u + 1], u);
+    });
+
+    // Every edge {u, v} connects the persona of u that contains v with the persona of v that
+    // contains u; the half edges of the personas of u are only added by the thread that visits u.
+    GraphBuilder builder(numPersonas);
+    G->balancedParallelForNodes([&](node u) {
+        const node *neighbors = adjacency.neighbors(u);
+        for (index j = 0; j < adjacency.degree(u); ++j) {
+            const node v = neighbors[j];
+            const node *neighborsOfV = adjacency.neighbors(v);
+            const node *end = neighborsOfV + adjacency.degree(v);
+            const index pos = std::lower_bound(neighborsOfV, end, u) - neighborsOfV;
+            builder.addHalfEdge(personaOffset[u] + localCommunity[adjacency.offset(u) + j],
+                                personaOffset[v] + localCommunity[adjacency.offset(v) + pos]);
+        }
+    });
+    personaGraph = builder.toGraph(false, true);
+
+    handler.assureRunning();
+
+    const Partition global = clusterGraph(personaGraph, globalClustering);
+    cover = Cover(z);
+    cover.setUpperBound(global.upperBound());
+    G->parallelForNodes([&](node u) {
+        for (index p = personaOffset[u]; p < personaOffset[u + 1]; ++p)
+            cover.addToSubset(global[p], u);
+    });
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
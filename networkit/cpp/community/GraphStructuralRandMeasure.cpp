@@ -16,18 +16,27 @@ double GraphStructuralRandMeasure::getDissimilarity(const Graph& G, const Partit
         throw std::runtime_error("The graph-structural rand measure is not defined for graphs without edges.");
     }
 
-    double e11 = 0.0; // number of connected node pairs for which clusterings agree
-    double e00 = 0.0; // number of connected node pairs for which clusterings disagree
-
-    G.forEdges([&](node u, node v){
-        if ((first[u] == first[v]) && (second[u] == second[v])) {
-            e11 += 1;
-        } else if ((first[u] != first[v]) && (second[u] != second[v])) {
-            e00 += 1;
-        }
-    });
-
-    double rand = 1.0 - (e11 + e00) * (1.0 / m);
+    count e11 = 0; // number of connected node pairs for which clusterings agree
+    count e00 = 0; // number of connected node pairs for which clusterings disagree
+
+    const bool directed = G.isDirected();
+    #pragma omp parallel for schedule(guided) reduction(+:e11, e00)
+    for (omp_index i = 0; i < static_cast<omp_index>(G.upperNodeIdBound()); ++i) {
+        const node u = static_cast<node>(i);
+        if (!G.hasNode(u))
+            continue;
+        G.forNeighborsOf(u, [&](node v) {
+            if (!directed && v > u)
+                return; // visit every undirected edge once
+            if ((first[u] == first[v]) && (second[u] == second[v])) {
+                e11 += 1;
+            } else if ((first[u] != first[v]) && (second[u] != second[v])) {
+                e00 += 1;
+            }
+        });
+    }
+
+    double rand = 1.0 - static_cast<double>(e11 + e00) * (1.0 / m);
 
     // assert range [0, 1]
     assert (rand <= 1.0);
@@ -5,48 +5,20 @@
  *      Author: Christian Staudt
  */
 
+#include <networkit/community/ContingencyTable.hpp>
 #include <networkit/community/JaccardMeasure.hpp>
-#include <networkit/community/PartitionIntersection.hpp>
 
 namespace NetworKit {
 
 double JaccardMeasure::getDissimilarity(const Graph& G, const Partition& zeta,
         const Partition& eta) {
 
-    Partition intersection = PartitionIntersection().calculate(zeta, eta);
+    const ContingencyTable table(G, zeta, eta);
+    assert(table.numberOfElements() == G.numberOfNodes());
 
-    std::vector<count> size_zeta(zeta.upperBound(), 0);
-    std::vector<count> size_eta(eta.upperBound(), 0);
-    std::vector<count> size_intersection(intersection.upperBound(), 0);
-
-    // precompute sizes for each cluster
-    G.forNodes([&](node u){
-        index C = zeta[u];
-        index D = eta[u];
-        index I = intersection[u];
-        assert (C != none);
-        assert (D != none);
-        assert (I != none);
-        size_zeta[C] += 1;
-        size_eta[D] += 1;
-        size_intersection[I] += 1;
-    });
-
-
-    count sumIntersection = 0;
-    for (count s : size_intersection) {
-        sumIntersection += s * (s - 1) / 2;
-    }
-
-    count sumZeta = 0;
-    for (count s : size_zeta) {
-        sumZeta += s * (s - 1) / 2;
-    }
-
-    count sumEta = 0;
-    for (count s : size_eta) {
-        sumEta += s * (s - 1) / 2;
-    }
+    count sumIntersection = table.pairsInEntries();
+    count sumZeta = table.pairsInFirst();
+    count sumEta = table.pairsInSecond();
 
     double n = G.numberOfNodes();
 
@@ -5,16 +5,25 @@
  *      Author: Christian Staudt
  */
 
+#include <atomic>
+#include <limits>
+#include <memory>
 #include <omp.h>
 
 #include <networkit/Globals.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/SparseVector.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/community/PLP.hpp>
 
 namespace NetworKit {
 
+namespace {
+// The nodes are swept densely once more than n / denseSweepDivisor of them are active.
+constexpr count denseSweepDivisor = 16;
+} // namespace
+
 PLP::PLP(const Graph& G, count theta, count maxIterations) : CommunityDetectionAlgorithm(G), updateThreshold(theta), maxIterations(maxIterations) {}
 
 PLP::PLP(const Graph &G, const Partition &baseClustering, count theta)
@@ -58,13 +67,74 @@ void PLP::run() {
      * In general this does not work. It was changed to: No label was changed in last iteration.
      */
 
-    std::vector<bool> activeNodes(z); // record if node must be processed
-    activeNodes.assign(z, true);
+    /**
+     * == Active nodes ==
+     *
+     * Only nodes with a neighbor that changed its label in the last iteration are processed. They
+     * are kept in an explicit frontier, which is processed directly while it is small. Once it
+     * contains more than a fixed fraction of the nodes, the nodes are swept in id order instead,
+     * which gives better load balancing and memory locality.
+     */
+    std::unique_ptr<std::atomic<bool>[]> activeNodes(new std::atomic<bool>[z] {});
+    std::vector<node> frontier;
+    frontier.reserve(n);
+    G->forNodes([&](node v) {
+        if (G->degree(v) > 0) {
+            activeNodes[v].store(true, std::memory_order_relaxed);
+            frontier.push_back(v);
+        }
+    });
+
+    // per-thread accumulators of the label weights and next frontiers
+    const count numThreads = omp_get_max_threads();
+    std::vector<Aux::SparseVector<edgeweight>> labelWeights(
+        numThreads, Aux::SparseVector<edgeweight>(
+                        result.upperBound(), -std::numeric_limits<edgeweight>::infinity()));
+    std::vector<std::vector<node>> nextFrontier(numThreads);
+
+    auto processNode = [&](node v) {
+        // v may appear in the frontier although it was processed during the last dense sweep
+        if (!activeNodes[v].exchange(false, std::memory_order_relaxed))
+            return false;
+        auto &weights = labelWeights[omp_get_thread_num()];
+
+        // weigh the labels in the neighborhood of v
+        G->forNeighborsOf(v, [&](node w, edgeweight weight) {
+            const label lw = result.subsetOf(w);
+            if (weights.indexIsUsed(lw))
+                weights[lw] += weight;
+            else
+                weights.insert(lw, weight);
+        });
+
+        // get heaviest label, ties are broken by the smallest label
+        label heaviest = none;
+        edgeweight heaviestWeight = 0;
+        weights.forElements([&](label l, edgeweight weight) {
+            if (heaviest == none || weight > heaviestWeight
+                || (weight == heaviestWeight && l < heaviest)) {
+                heaviest = l;
+                heaviestWeight = weight;
+            }
+        });
+        weights.reset();
+
+        if (result.subsetOf(v) == heaviest)
+            return false;
+
+        result.moveToSubset(heaviest, v); // result[v] = heaviest;
+        auto &next = nextFrontier[omp_get_thread_num()];
+        G->forNeighborsOf(v, [&](node u) {
+            if (!activeNodes[u].exchange(true, std::memory_order_relaxed))
+                next.push_back(u);
+        });
+        return true;
+    };
 
     Aux::Timer runtime;
 
     // propagate labels
-    while ((nUpdated > this->updateThreshold)  && (nIterations < maxIterations)) { // as long as a label has changed... or maximum iterations reached
+    while ((nUpdated > this->updateThreshold) && (nIterations < maxIterations) && !frontier.empty()) { // as long as a label has changed... or maximum iterations reached
         runtime.start();
         nIterations += 1;
         DEBUG("[BEGIN] LabelPropagation: iteration #" , nIterations);
@@ -72,43 +142,34 @@ void PLP::run() {
         // reset updated
         nUpdated = 0;
 
-        G->balancedParallelForNodes([&](node v){
-            if ((activeNodes[v]) && (G->degree(v) > 0)) {
-
-                std::map<label, double> labelWeights; // neighborLabelCounts maps label -> frequency in the neighbors
-
-                // weigh the labels in the neighborhood of v
-                G->forNeighborsOf(v, [&](node w, edgeweight weight) {
-                    label lw = result.subsetOf(w);
-                    labelWeights[lw] += weight; // add weight of edge {v, w}
-                });
-
-                // get heaviest label
-                label heaviest = std::max_element(labelWeights.begin(),
-                                labelWeights.end(),
-                                [](const std::pair<label, edgeweight>& p1, const std::pair<label, edgeweight>& p2) {
-                                    return p1.second < p2.second;})->first;
-
-                if (result.subsetOf(v) != heaviest) { // UPDATE
-                    result.moveToSubset(heaviest,v); //result[v] = heaviest;
-                    nUpdated += 1; // TODO: atomic update?
-                    G->forNeighborsOf(v, [&](node u) {
-                        activeNodes[u] = true;
-                    });
-                } else {
-                    activeNodes[v] = false;
+        if (frontier.size() * denseSweepDivisor > n) {
+            count updated = 0;
+            G->balancedParallelForNodes([&](node v) {
+                if (activeNodes[v].load(std::memory_order_relaxed) && processNode(v)) {
+#pragma omp atomic
+                    ++updated;
                 }
-
-            } else {
-                // node is isolated
-            }
-        });
+            });
+            nUpdated = updated;
+        } else {
+            count updated = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : updated)
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i)
+                updated += processNode(frontier[i]);
+            nUpdated = updated;
+        }
+
+        frontier.clear();
+        for (auto &next : nextFrontier) {
+            frontier.insert(frontier.end(), next.begin(), next.end());
+            next.clear();
+        }
 
         // for each while loop iteration...
 
         runtime.stop();
         this->timing.push_back(runtime.elapsedMilliseconds());
-        DEBUG("[DONE] LabelPropagation: iteration #" , nIterations , " - updated " , nUpdated , " labels, time spent: " , runtime.elapsedTag());
+        DEBUG("[DONE] LabelPropagation: iteration #" , nIterations , " - updated " , nUpdated , " labels, " , frontier.size(), " active nodes, time spent: " , runtime.elapsedTag());
 
     } // end while
     hasRun = true;
@@ -0,0 +1,393 @@
+/*
+ * ParallelLeiden.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <omp.h>
+#include <random>
+#include <sstream>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/SparseVector.hpp>
+#include <networkit/community/PLM.hpp>
+#include <networkit/community/ParallelLeiden.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Randomness of the merges in the refinement phase; a subcommunity is chosen with a probability
+// proportional to exp(gain / theta).
+constexpr double theta = 0.01;
+
+// Affinities are non-negative sums, hence -infinity marks unused entries.
+constexpr edgeweight noAffinity = -std::numeric_limits<edgeweight>::infinity();
+
+std::vector<double> communityWeights(const Graph &H, const Partition &zeta,
+                                     const std::vector<double> &nodeWeight) {
+    std::vector<double> weight(zeta.upperBound(), 0.0);
+    H.parallelForNodes([&](node u) {
+        const double w = nodeWeight[u];
+#pragma omp atomic
+        weight[zeta[u]] += w;
+    });
+    return weight;
+}
+
+// Splits every community into its connected components, which never decreases the quality.
+void splitDisconnected(const Graph &H, Partition &zeta) {
+    std::vector<index> component(H.upperNodeIdBound(), none);
+    std::vector<unsigned char> seen(zeta.upperBound(), 0);
+    index nextId = zeta.upperBound();
+    std::vector<node> stack;
+
+    H.forNodes([&](node s) {
+        if (component[s] != none)
+            return;
+        const index c = zeta[s];
+        const index id = seen[c] ? nextId++ : c;
+        seen[c] = 1;
+        component[s] = id;
+        stack.assign(1, s);
+        while (!stack.empty()) {
+            const node u = stack.back();
+            stack.pop_back();
+            H.forNeighborsOf(u, [&](node v) {
+                if (component[v] == none && zeta[v] == c) {
+                    component[v] = id;
+                    stack.push_back(v);
+                }
+            });
+        }
+    });
+
+    zeta.setUpperBound(nextId);
+    H.parallelForNodes([&](node u) { zeta[u] = component[u]; });
+}
+
+} // namespace
+
+ParallelLeiden::ParallelLeiden(const Graph &G, double gamma, Quality quality, count iterations,
+                               bool randomize, count maxIter)
+    : CommunityDetectionAlgorithm(G), gamma(gamma), quality(quality), iterations(iterations),
+      randomize(randomize), maxIter(maxIter) {
+    if (G.isDirected())
+        throw std::runtime_error("ParallelLeiden is not implemented for directed graphs");
+    if (gamma < 0)
+        throw std::runtime_error("Error: gamma must be non-negative");
+}
+
+void ParallelLeiden::run() {
+    Aux::SignalHandler handler;
+
+    const count z = G->upperNodeIdBound();
+    const edgeweight total = G->totalEdgeWeight();
+    if (quality == modularity)
+        penalty = total > 0 ? gamma / (2 * total) : 0.0;
+    else
+        penalty = gamma;
+
+    result = Partition(z);
+    result.setUpperBound(z);
+    G->parallelForNodes([&](node u) { result[u] = u; });
+
+    performedIterations = 0;
+    while (performedIterations < iterations) {
+        handler.assureRunning();
+        ++performedIterations;
+        if (!leidenPass(result))
+            break;
+    }
+
+    hasRun = true;
+}
+
+bool ParallelLeiden::leidenPass(Partition &zeta) const {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+
+    // Weights of the (super) nodes: volumes for modularity and sizes for CPM.
+    std::vector<double> nodeWeight(z, 0.0);
+    std::vector<node> fineToCurrent(z, none);
+    G->parallelForNodes([&](node u) {
+        nodeWeight[u] = quality == modularity ? G->weightedDegree(u, true) : 1.0;
+        fineToCurrent[u] = u;
+    });
+
+    const Graph *current = G;
+    Graph coarse;
+    Partition communities = zeta;
+    bool changed = false;
+
+    while (true) {
+        handler.assureRunning();
+        changed |= movePhase(*current, communities, nodeWeight);
+        if (communities.numberOfSubsets() == current->numberOfNodes())
+            break;
+
+        // Aggregate according to the refined partition; if the refinement could not merge any
+        // nodes, the level is final.
+        const Partition refined = refinePhase(*current, communities, nodeWeight);
+        if (refined.numberOfSubsets() == current->numberOfNodes())
+            break;
+        auto coarsened = PLM::coarsen(*current, refined);
+        const std::vector<node> &fineToCoarse = coarsened.second;
+        const count numCoarse = coarsened.first.numberOfNodes();
+        DEBUG("aggregated graph has ", numCoarse, " nodes and ", coarsened.first.numberOfEdges(),
+              " edges");
+
+        // The communities of the moving phase become the initial partition of the coarse graph.
+        std::vector<double> coarseWeight(numCoarse, 0.0);
+        Partition coarseCommunities(numCoarse);
+        coarseCommunities.setUpperBound(communities.upperBound());
+        current->forNodes([&](node u) {
+            coarseWeight[fineToCoarse[u]] += nodeWeight[u];
+            coarseCommunities[fineToCoarse[u]] = communities[u];
+        });
+        G->parallelForNodes([&](node u) { fineToCurrent[u] = fineToCoarse[fineToCurrent[u]]; });
+
+        coarse = std::move(coarsened.first);
+        current = &coarse;
+        nodeWeight = std::move(coarseWeight);
+        communities = std::move(coarseCommunities);
+    }
+
+    // The (super) nodes of the final level induce connected subgraphs, hence splitting the
+    // communities there makes them connected in G as well.
+    splitDisconnected(*current, communities);
+
+    Partition fine(z);
+    fine.setUpperBound(communities.upperBound());
+    G->parallelForNodes([&](node u) { fine[u] = communities[fineToCurrent[u]]; });
+    fine.compact(true);
+    zeta = std::move(fine);
+
+    return changed;
+}
+
+bool ParallelLeiden::movePhase(const Graph &H, Partition &zeta,
+                               const std::vector<double> &nodeWeight) const {
+    Aux::SignalHandler handler;
+    const count z = H.upperNodeIdBound();
+    std::vector<double> communityWeight = communityWeights(H, zeta, nodeWeight);
+
+    // Only nodes whose neighborhood changed are revisited in the next round.
+    std::vector<node> active;
+    active.reserve(H.numberOfNodes());
+    H.forNodes([&](node u) { active.push_back(u); });
+    std::unique_ptr<std::atomic<bool>[]> queued(new std::atomic<bool>[z] {});
+    H.parallelForNodes([&](node u) { queued[u].store(true, std::memory_order_relaxed); });
+
+    const count numThreads = static_cast<count>(omp_get_max_threads());
+    std::vector<Aux::SparseVector<edgeweight>> affinities(numThreads);
+    std::vector<std::vector<node>> nextActive(numThreads);
+    bool changed = false;
+
+    for (count round = 0; !active.empty() && round < maxIter; ++round) {
+        handler.assureRunning();
+        if (randomize)
+            std::shuffle(active.begin(), active.end(), Aux::Random::getURNG());
+
+        bool moved = false;
+#pragma omp parallel
+        {
+            const index tid = omp_get_thread_num();
+            auto &affinity = affinities[tid];
+            if (affinity.upperBound() < zeta.upperBound())
+                affinity.resize(zeta.upperBound(), noAffinity);
+            auto &next = nextActive[tid];
+
+#pragma omp for schedule(guided) reduction(|| : moved)
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+                const node u = active[i];
+                queued[u].store(false, std::memory_order_relaxed);
+
+                const index C = zeta[u];
+                affinity.insert(C, 0.0);
+                H.forNeighborsOf(u, [&](node v, edgeweight ew) {
+                    if (u == v)
+                        return;
+                    const index D = zeta[v];
+                    if (affinity.indexIsUsed(D))
+                        affinity[D] += ew;
+                    else
+                        affinity.insert(D, ew);
+                });
+
+                const double wu = nodeWeight[u];
+                double weightC;
+#pragma omp atomic read
+                weightC = communityWeight[C];
+                weightC -= wu;
+
+                index best = none;
+                double bestGain = 0;
+                for (const index D : affinity.usedIndices()) {
+                    if (D == C)
+                        continue;
+                    double weightD;
+#pragma omp atomic read
+                    weightD = communityWeight[D];
+                    const double gain =
+                        affinity[D] - affinity[C] - penalty * wu * (weightD - weightC);
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        best = D;
+                    }
+                }
+                affinity.reset();
+
+                if (best == none)
+                    continue;
+
+                // The community weights are only updated for actual moves.
+                zeta[u] = best;
+#pragma omp atomic
+                communityWeight[C] -= wu;
+#pragma omp atomic
+                communityWeight[best] += wu;
+                moved = true;
+
+                H.forNeighborsOf(u, [&](node v) {
+                    if (zeta[v] != best && !queued[v].exchange(true, std::memory_order_relaxed))
+                        next.push_back(v);
+                });
+            }
+        }
+
+        active.clear();
+        for (auto &next : nextActive) {
+            active.insert(active.end(), next.begin(), next.end());
+            next.clear();
+        }
+        changed |= moved;
+    }
+
+    return changed;
+}
+
+Partition ParallelLeiden::refinePhase(const Graph &H, const Partition &zeta,
+                                      const std::vector<double> &nodeWeight) const {
+    const count z = H.upperNodeIdBound();
+    const std::vector<double> communityWeight = communityWeights(H, zeta, nodeWeight);
+
+    std::vector<std::vector<node>> members(zeta.upperBound());
+    H.forNodes([&](node u) { members[zeta[u]].push_back(u); });
+
+    // Every subcommunity is identified by the node it started from. subsetCut stores the weight of
+    // the edges between a subcommunity and the rest of its community.
+    Partition refined(z);
+    refined.setUpperBound(z);
+    std::vector<double> subsetWeight(z, 0.0);
+    std::vector<edgeweight> subsetCut(z, 0.0);
+    std::vector<unsigned char> singleton(z, 0);
+    H.parallelForNodes([&](node u) {
+        refined[u] = u;
+        subsetWeight[u] = nodeWeight[u];
+        singleton[u] = 1;
+        edgeweight cut = 0;
+        H.forNeighborsOf(u, [&](node v, edgeweight ew) {
+            if (v != u && zeta[v] == zeta[u])
+                cut += ew;
+        });
+        subsetCut[u] = cut;
+    });
+
+    auto wellConnected = [&](double cut, double weight, double totalWeight) {
+        return cut >= penalty * weight * (totalWeight - weight);
+    };
+
+    // The communities are refined independently of each other.
+#pragma omp parallel
+    {
+        Aux::SparseVector<edgeweight> affinity(z, noAffinity);
+        std::vector<index> candidates;
+        std::vector<double> weights;
+        auto &urng = Aux::Random::getURNG();
+
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(members.size()); ++c) {
+            std::vector<node> &nodes = members[c];
+            if (nodes.size() < 2)
+                continue;
+            if (randomize)
+                std::shuffle(nodes.begin(), nodes.end(), urng);
+            const double totalWeight = communityWeight[c];
+
+            for (const node v : nodes) {
+                const double wv = nodeWeight[v];
+                if (!singleton[v] || !wellConnected(subsetCut[v], wv, totalWeight))
+                    continue;
+
+                H.forNeighborsOf(v, [&](node x, edgeweight ew) {
+                    if (x == v || zeta[x] != static_cast<index>(c))
+                        return;
+                    const index S = refined[x];
+                    if (affinity.indexIsUsed(S))
+                        affinity[S] += ew;
+                    else
+                        affinity.insert(S, ew);
+                });
+
+                // Staying a singleton is always an option.
+                candidates.assign(1, v);
+                weights.assign(1, 0.0);
+                index best = v;
+                double bestGain = 0;
+                for (const index S : affinity.usedIndices()) {
+                    if (!wellConnected(subsetCut[S], subsetWeight[S], totalWeight))
+                        continue;
+                    const double gain = affinity[S] - penalty * wv * subsetWeight[S];
+                    if (gain < 0)
+                        continue;
+                    candidates.push_back(S);
+                    weights.push_back(gain);
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        best = S;
+                    }
+                }
+
+                if (randomize && candidates.size() > 1) {
+                    for (double &weight : weights)
+                        weight = std::exp((weight - bestGain) / theta);
+                    std::discrete_distribution<index> distribution(weights.begin(), weights.end());
+                    best = candidates[distribution(urng)];
+                }
+
+                if (best != v) {
+                    refined[v] = best;
+                    subsetWeight[best] += wv;
+                    subsetCut[best] += subsetCut[v] - 2 * affinity[best];
+                    singleton[v] = 0;
+                    singleton[best] = 0;
+                }
+                affinity.reset();
+            }
+        }
+    }
+
+    return refined;
+}
+
+std::string ParallelLeiden::toString() const {
+    std::stringstream stream;
+    stream << "ParallelLeiden(" << (quality == modularity ? "modularity" : "cpm") << ",gamma="
+           << gamma;
+    if (randomize)
+        stream << ",randomized";
+    stream << ")";
+    return stream.str();
+}
+
+} // namespace NetworKit
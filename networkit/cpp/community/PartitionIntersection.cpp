@@ -1,15 +1,27 @@
 #include <algorithm>
 
+#include <networkit/community/ContingencyTable.hpp>
 #include <networkit/community/PartitionIntersection.hpp>
+#include <networkit/structures/CompactCover.hpp>
 
 NetworKit::Partition NetworKit::PartitionIntersection::calculate(const Partition &zeta, const NetworKit::Partition &eta) {
+    // The contingency table needs memory proportional to the upper bounds of the subset ids, so
+    // sparse ids are compacted first; this keeps their order and thus the result.
+    auto sparse = [](const Partition &p) {
+        return !CompactCover::isDenseIdRange(p.upperBound(), p.numberOfElements());
+    };
+    if (sparse(zeta) || sparse(eta)) {
+        Partition compactZeta(zeta), compactEta(eta);
+        compactZeta.compact();
+        compactEta.compact();
+        return calculate(compactZeta, compactEta);
+    }
+
+    const ContingencyTable table(zeta, eta);
     Partition result(std::max(zeta.numberOfElements(), eta.numberOfElements()));
-    result.setUpperBound(zeta.upperBound()*eta.upperBound());
-    zeta.parallelForEntries([&](node u, index s) {
-        if (zeta.contains(u) && eta.contains(u)) {
-            result[u] = s * eta.upperBound() + eta[u];
-        }
+    result.setUpperBound(table.numberOfEntries());
+    result.parallelForEntries([&](index e, index) {
+        result[e] = table.entryOf(e);
     });
-    result.compact();
     return result;
 }
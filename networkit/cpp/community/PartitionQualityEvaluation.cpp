@@ -0,0 +1,258 @@
+/*
+ * PartitionQualityEvaluation.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <omp.h>
+#include <stdexcept>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/community/PartitionQualityEvaluation.hpp>
+#include <networkit/components/ConnectedComponents.hpp>
+#include <networkit/structures/CompactCover.hpp>
+
+namespace NetworKit {
+
+PartitionQualityEvaluation::PartitionQualityEvaluation(const Graph &G, const Partition &zeta)
+    : PartitionQualityEvaluation(G, zeta,
+                                 {MODULARITY, COVERAGE, EDGE_CUT, CONDUCTANCE,
+                                  INTRAPARTITION_DENSITY, HUB_DOMINANCE, FRAGMENTATION}) {}
+
+PartitionQualityEvaluation::PartitionQualityEvaluation(const Graph &G, const Partition &zeta,
+                                                       const std::vector<Measure> &measures)
+    : G(&G), zeta(&zeta), selected(numMeasures, false) {
+    if (G.isDirected())
+        throw std::runtime_error(
+            "PartitionQualityEvaluation is not implemented for directed graphs");
+    for (const Measure m : measures)
+        selected[m] = true;
+}
+
+void PartitionQualityEvaluation::checkMeasure(Measure m) const {
+    assureFinished();
+    if (!selected[m])
+        throw std::runtime_error("Error, the measure has not been selected for evaluation");
+}
+
+double PartitionQualityEvaluation::getValue(Measure m) const {
+    checkMeasure(m);
+    return globalValues[m];
+}
+
+const std::vector<double> &PartitionQualityEvaluation::getClusterValues(Measure m) const {
+    checkMeasure(m);
+    return clusterValues[m];
+}
+
+void PartitionQualityEvaluation::run() {
+    Aux::SignalHandler handler;
+    sweep();
+    handler.assureRunning();
+
+    const count k = size.size();
+    clusterValues.assign(numMeasures, {});
+    globalValues.assign(numMeasures, 0.0);
+    for (index m = 0; m < numMeasures; ++m)
+        if (selected[m])
+            clusterValues[m].assign(k, 0.0);
+
+    const double totalWeight = G->totalEdgeWeight();
+    if ((selected[MODULARITY] || selected[COVERAGE]) && totalWeight == 0.0)
+        throw std::invalid_argument("Modularity and coverage are undefined for graphs without "
+                                    "edges (including self-loops).");
+
+    double totalVolume = 0;
+#pragma omp parallel for reduction(+ : totalVolume)
+    for (omp_index c = 0; c < static_cast<omp_index>(k); ++c)
+        totalVolume += volume[c];
+
+    double coverage = 0, expectedCoverage = 0, cut = 0, hubDominance = 0;
+    count intraEdges = 0, possibleIntraEdges = 0;
+#pragma omp parallel for reduction(+ : coverage, expectedCoverage, cut, hubDominance, intraEdges, \
+                                   possibleIntraEdges)
+    for (omp_index c = 0; c < static_cast<omp_index>(k); ++c) {
+        if (size[c] == 0)
+            continue;
+
+        if (selected[MODULARITY] || selected[COVERAGE]) {
+            const double cov = internalWeight[c] / totalWeight;
+            const double expCov = (volume[c] / totalWeight) * (volume[c] / totalWeight) / 4;
+            coverage += cov;
+            expectedCoverage += expCov;
+            if (selected[MODULARITY])
+                clusterValues[MODULARITY][c] = cov - expCov;
+            if (selected[COVERAGE])
+                clusterValues[COVERAGE][c] = cov;
+        }
+
+        cut += cutWeight[c];
+        if (selected[EDGE_CUT])
+            clusterValues[EDGE_CUT][c] = cutWeight[c];
+
+        if (selected[CONDUCTANCE] && cutWeight[c] > 0)
+            clusterValues[CONDUCTANCE][c] =
+                cutWeight[c] / std::min(volume[c], totalVolume - volume[c]);
+
+        const count possibleEdges = size[c] * (size[c] - 1) / 2;
+        intraEdges += internalEdges[c];
+        possibleIntraEdges += possibleEdges;
+        if (selected[INTRAPARTITION_DENSITY])
+            clusterValues[INTRAPARTITION_DENSITY][c] =
+                possibleEdges > 0 ? static_cast<double>(internalEdges[c]) / possibleEdges : 1.0;
+
+        if (selected[HUB_DOMINANCE]) {
+            const double dominance =
+                size[c] > 1 ? static_cast<double>(maxInternalDegree[c]) / (size[c] - 1) : 1.0;
+            clusterValues[HUB_DOMINANCE][c] = dominance;
+            hubDominance += dominance;
+        }
+    }
+
+    globalValues[MODULARITY] = coverage - expectedCoverage;
+    globalValues[COVERAGE] = coverage;
+    // Every cut edge between two assigned nodes has been counted by both clusters.
+    globalValues[EDGE_CUT] = cut - interClusterWeight;
+    // Without clusters, the maxima and averages over the clusters are 0.
+    if (selected[CONDUCTANCE] && k > 0)
+        globalValues[CONDUCTANCE] = *std::max_element(clusterValues[CONDUCTANCE].begin(),
+                                                      clusterValues[CONDUCTANCE].end());
+    if (possibleIntraEdges > 0)
+        globalValues[INTRAPARTITION_DENSITY] =
+            static_cast<double>(intraEdges) / static_cast<double>(possibleIntraEdges);
+    else
+        globalValues[INTRAPARTITION_DENSITY] = numClusters > 0 ? 1.0 : 0.0;
+    if (numClusters > 0)
+        globalValues[HUB_DOMINANCE] = hubDominance / numClusters;
+
+    if (selected[FRAGMENTATION]) {
+        handler.assureRunning();
+        computeFragmentation();
+    }
+
+    hasRun = true;
+}
+
+void PartitionQualityEvaluation::sweep() {
+    const count z = G->upperNodeIdBound();
+    const count k = zeta->upperBound();
+
+    // Statistics of the clusters, accumulated by every thread separately and merged afterwards;
+    // a thread that does not take part in the loop leaves its accumulator empty.
+    struct Accumulator {
+        std::vector<count> size, internalEdges, maxInternalDegree;
+        std::vector<double> volume, internalWeight, cutWeight;
+    };
+    std::vector<Accumulator> local(omp_get_max_threads());
+
+    double sharedCut = 0;
+#pragma omp parallel reduction(+ : sharedCut)
+    {
+        Accumulator &acc = local[omp_get_thread_num()];
+        acc.size.assign(k, 0);
+        acc.internalEdges.assign(k, 0);
+        acc.maxInternalDegree.assign(k, 0);
+        acc.volume.assign(k, 0.0);
+        acc.internalWeight.assign(k, 0.0);
+        acc.cutWeight.assign(k, 0.0);
+
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+            const node u = static_cast<node>(i);
+            if (!G->hasNode(u))
+                continue;
+            const index c = (*zeta)[u];
+            if (c == none)
+                continue;
+
+            double vol = 0, internal = 0, cut = 0;
+            count internalEdges = 0, internalDegree = 0;
+            G->forNeighborsOf(u, [&](node v, edgeweight ew) {
+                vol += (u == v) ? 2 * ew : ew;
+                const index d = (*zeta)[v];
+                if (d == c) {
+                    ++internalDegree;
+                    if (v >= u) {
+                        internal += ew;
+                        ++internalEdges;
+                    }
+                } else {
+                    cut += ew;
+                    if (d != none && v > u)
+                        sharedCut += ew;
+                }
+            });
+
+            ++acc.size[c];
+            acc.volume[c] += vol;
+            acc.internalWeight[c] += internal;
+            acc.cutWeight[c] += cut;
+            acc.internalEdges[c] += internalEdges;
+            acc.maxInternalDegree[c] = std::max(acc.maxInternalDegree[c], internalDegree);
+        }
+    }
+    interClusterWeight = sharedCut;
+
+    // Merge the accumulators of the threads.
+    size.assign(k, 0);
+    internalEdges.assign(k, 0);
+    maxInternalDegree.assign(k, 0);
+    volume.assign(k, 0.0);
+    internalWeight.assign(k, 0.0);
+    cutWeight.assign(k, 0.0);
+
+    count nonempty = 0;
+#pragma omp parallel for reduction(+ : nonempty)
+    for (omp_index c = 0; c < static_cast<omp_index>(k); ++c) {
+        for (const Accumulator &acc : local) {
+            if (acc.size.empty())
+                continue;
+            size[c] += acc.size[c];
+            volume[c] += acc.volume[c];
+            internalWeight[c] += acc.internalWeight[c];
+            cutWeight[c] += acc.cutWeight[c];
+            internalEdges[c] += acc.internalEdges[c];
+            maxInternalDegree[c] = std::max(maxInternalDegree[c], acc.maxInternalDegree[c]);
+        }
+        nonempty += size[c] > 0;
+    }
+    numClusters = nonempty;
+}
+
+void PartitionQualityEvaluation::computeFragmentation() {
+    ConnectedComponents cc(*G);
+    cc.run();
+    const CompactCover members(*zeta);
+
+    // The fragmentation of a cluster is 1 - (size of its largest part inside a connected component
+    // of the graph) / (size of the cluster).
+    auto &values = clusterValues[FRAGMENTATION];
+    double sum = 0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(+ : sum)
+    for (omp_index c = 0; c < static_cast<omp_index>(size.size()); ++c) {
+        if (size[c] == 0)
+            continue;
+        std::vector<index> components;
+        components.reserve(size[c]);
+        members.forMembersOf(c, [&](node u) {
+            if (G->hasNode(u))
+                components.push_back(cc.componentOfNode(u));
+        });
+        std::sort(components.begin(), components.end());
+
+        count largest = 0;
+        for (index i = 0, j = 0; i < components.size(); i = j) {
+            while (j < components.size() && components[j] == components[i])
+                ++j;
+            largest = std::max(largest, j - i);
+        }
+        values[c] = 1.0 - static_cast<double>(largest) / size[c];
+        sum += values[c];
+    }
+    globalValues[FRAGMENTATION] = numClusters > 0 ? sum / numClusters : 0.0;
+}
+
+} // namespace NetworKit
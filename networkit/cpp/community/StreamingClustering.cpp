@@ -0,0 +1,205 @@
+/*
+ * StreamingClustering.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+#include <networkit/coarsening/ClusteringProjector.hpp>
+#include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
+#include <networkit/community/PLM.hpp>
+#include <networkit/community/StreamingClustering.hpp>
+
+namespace NetworKit {
+
+StreamingClustering::StreamingClustering(edgeweight maxVolume) : maxVolume(maxVolume) {
+    if (maxVolume <= 0)
+        throw std::runtime_error("The maximum volume of a community must be positive");
+}
+
+void StreamingClustering::ensureNode(node u) {
+    if (u == none)
+        throw std::runtime_error("Invalid node id in the stream");
+    for (node v = community.size(); v <= u; ++v) {
+        degree.push_back(0);
+        community.push_back(v);
+        volume.push_back(0);
+    }
+}
+
+void StreamingClustering::changeWeight(node u, node v, edgeweight delta) {
+    ensureNode(u);
+    ensureNode(v);
+    degree[u] += delta;
+    degree[v] += delta;
+    volume[community[u]] += delta;
+    volume[community[v]] += delta;
+}
+
+void StreamingClustering::addEdge(node u, node v, edgeweight w) {
+    changeWeight(u, v, w);
+    ++numEdges;
+
+    const index cu = community[u], cv = community[v];
+    if (cu == cv || volume[cu] > maxVolume || volume[cv] > maxVolume)
+        return;
+
+    // The endpoint in the community with the smaller volume joins the other community.
+    if (volume[cu] <= volume[cv]) {
+        volume[cu] -= degree[u];
+        volume[cv] += degree[u];
+        community[u] = cv;
+    } else {
+        volume[cv] -= degree[v];
+        volume[cu] += degree[v];
+        community[v] = cu;
+    }
+}
+
+void StreamingClustering::update(const GraphEvent &event) {
+    switch (event.type) {
+    case GraphEvent::NODE_ADDITION:
+        onNodeAddition(event.u);
+        break;
+    case GraphEvent::NODE_REMOVAL:
+        onNodeRemoval(event.u);
+        break;
+    case GraphEvent::NODE_RESTORATION:
+        onNodeRestoration(event.u);
+        break;
+    case GraphEvent::EDGE_ADDITION:
+        onEdgeAddition(event.u, event.v, event.w);
+        break;
+    case GraphEvent::EDGE_REMOVAL:
+        onEdgeRemoval(event.u, event.v, event.w);
+        break;
+    case GraphEvent::EDGE_WEIGHT_UPDATE:
+        // The stream does not store edge weights, so the old weight is unknown.
+        throw std::runtime_error("EDGE_WEIGHT_UPDATE events are not supported, use "
+                                 "EDGE_WEIGHT_INCREMENT instead");
+    case GraphEvent::EDGE_WEIGHT_INCREMENT:
+        onWeightIncrement(event.u, event.v, 0.0, event.w);
+        break;
+    case GraphEvent::TIME_STEP:
+        onTimeStep();
+        break;
+    }
+}
+
+void StreamingClustering::updateBatch(const std::vector<GraphEvent> &batch) {
+    for (const GraphEvent &event : batch)
+        update(event);
+}
+
+void StreamingClustering::readEdgeList(const std::string &path, char separator, node firstNode,
+                                       const std::string &commentPrefix) {
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("Unable to read from file " + path);
+
+    auto skipSeparators = [separator](const char *it) {
+        while (*it == ' ' || *it == separator)
+            ++it;
+        return it;
+    };
+
+    auto scanNode = [&](const char *&it) -> node {
+        char *past;
+        const unsigned long long value = std::strtoull(it, &past, 10);
+        if (past == it || value < firstNode)
+            throw std::runtime_error("Scanning node failed. The file may be corrupt.");
+        it = past;
+        return static_cast<node>(value) - firstNode;
+    };
+
+    std::string line;
+    while (std::getline(file, line)) {
+        const char *it = skipSeparators(line.c_str());
+        if (*it == '\0' || *it == '\r')
+            continue;
+        if (!commentPrefix.empty() && line.compare(it - line.c_str(), commentPrefix.size(),
+                                                   commentPrefix) == 0)
+            continue;
+
+        const node u = scanNode(it);
+        it = skipSeparators(it);
+        const node v = scanNode(it);
+        it = skipSeparators(it);
+
+        edgeweight w = 1.0;
+        if (*it != '\0' && *it != '\r') {
+            char *past;
+            w = std::strtod(it, &past);
+            if (past == it)
+                throw std::runtime_error("Error in parsing file - looking for weight failed");
+        }
+        addEdge(u, v, w);
+    }
+}
+
+Partition StreamingClustering::getPartition() const {
+    Partition zeta(community.size());
+    zeta.setUpperBound(community.size());
+    zeta.parallelForEntries([&](index u, index) { zeta[u] = community[u]; });
+    return zeta;
+}
+
+Partition StreamingClustering::refine(const Graph &G) const {
+    if (G.isDirected())
+        throw std::runtime_error("Refinement is not implemented for directed graphs");
+
+    const count z = G.upperNodeIdBound();
+    Partition zeta(z);
+    zeta.setUpperBound(std::max(z, community.size()));
+    G.parallelForNodes([&](node u) { zeta[u] = u < community.size() ? community[u] : u; });
+
+    ParallelPartitionCoarsening coarsening(G, zeta);
+    coarsening.run();
+    const Graph &coarse = coarsening.getCoarseGraph();
+
+    PLM plm(coarse);
+    plm.run();
+
+    ClusteringProjector projector;
+    return projector.projectBack(coarse, G, coarsening.getFineToCoarseNodeMapping(),
+                                 plm.getPartition());
+}
+
+void StreamingClustering::onNodeAddition(node u) {
+    ensureNode(u);
+}
+
+void StreamingClustering::onNodeRemoval(node) {
+    // The edges of a node are removed before the node itself, nothing to do.
+}
+
+void StreamingClustering::onNodeRestoration(node u) {
+    ensureNode(u);
+}
+
+void StreamingClustering::onEdgeAddition(node u, node v, edgeweight w) {
+    addEdge(u, v, w);
+}
+
+void StreamingClustering::onEdgeRemoval(node u, node v, edgeweight w) {
+    changeWeight(u, v, -w);
+    --numEdges;
+}
+
+void StreamingClustering::onWeightUpdate(node u, node v, edgeweight wOld, edgeweight wNew) {
+    changeWeight(u, v, wNew - wOld);
+}
+
+void StreamingClustering::onWeightIncrement(node u, node v, edgeweight, edgeweight delta) {
+    changeWeight(u, v, delta);
+}
+
+void StreamingClustering::onTimeStep() {}
+
+} // namespace NetworKit
@@ -7,9 +7,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 #include <networkit/community/PLP.hpp>
 #include <networkit/community/PLM.hpp>
+#include <networkit/community/DynPLM.hpp>
+#include <networkit/dynamics/GraphDifference.hpp>
+#include <networkit/dynamics/GraphUpdater.hpp>
+#include <networkit/community/EgoSplitting.hpp>
+#include <networkit/community/StreamingClustering.hpp>
 #include <networkit/community/ParallelAgglomerativeClusterer.hpp>
+#include <networkit/community/ParallelLeiden.hpp>
 #include <networkit/community/Modularity.hpp>
 #include <networkit/community/EdgeCut.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
@@ -18,7 +28,9 @@
 #include <networkit/community/PLM.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/structures/Partition.hpp>
+#include <networkit/structures/UnionFind.hpp>
 #include <networkit/community/Modularity.hpp>
 #include <networkit/community/Coverage.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
@@ -33,11 +45,16 @@
 #include <networkit/community/SampledNodeStructuralRandMeasure.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
 #include <networkit/community/PartitionIntersection.hpp>
+#include <networkit/community/ContingencyTable.hpp>
 #include <networkit/community/HubDominance.hpp>
 #include <networkit/community/IntrapartitionDensity.hpp>
 #include <networkit/community/PartitionFragmentation.hpp>
+#include <networkit/community/PartitionHubDominance.hpp>
+#include <networkit/community/PartitionQualityEvaluation.hpp>
+#include <networkit/community/Conductance.hpp>
 #include <networkit/generators/ClusteredRandomGraphGenerator.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/community/CoverF1Similarity.hpp>
 
 #include <tlx/unused.hpp>
@@ -146,6 +163,29 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
 
 }
 
+TEST_F(CommunityGTest, testLabelPropagationFromBaseClustering) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator graphGen(300, 6, 1.0, 0.0);
+    Graph G = graphGen.generate();
+    const Partition reference = graphGen.getCommunities();
+
+    // starting from the solution, no label changes
+    PLP stable(G, reference);
+    stable.run();
+    EXPECT_EQ(stable.numberOfIterations(), 1);
+    EXPECT_TRUE(GraphClusteringTools::equalClusterings(stable.getPartition(), reference, G));
+
+    // a few wrong labels are corrected by propagating from a small frontier
+    Partition perturbed = reference;
+    for (node u = 0; u < 300; u += 50)
+        perturbed[u] = reference[(u + 1) % 300] == reference[u] ? reference[(u + 150) % 300]
+                                                               : reference[(u + 1) % 300];
+    PLP lp(G, perturbed, 0);
+    lp.run();
+    EXPECT_TRUE(GraphClusteringTools::equalClusterings(lp.getPartition(), reference, G));
+    EXPECT_EQ(lp.getTiming().size(), lp.numberOfIterations());
+}
+
 TEST_F(CommunityGTest, testPLM) {
     METISGraphReader reader;
     Modularity modularity;
@@ -198,6 +238,268 @@ TEST_F(CommunityGTest, testDeletedNodesPLM) {
 
 }
 
+TEST_F(CommunityGTest, testParallelLeiden) {
+    Aux::Random::setSeed(42, false);
+    METISGraphReader reader;
+    Modularity modularity;
+    Graph G = reader.read("input/PGPgiantcompo.graph");
+    G.removeNode(10);
+
+    PLM plm(G, true, 1.0);
+    plm.run();
+    const double plmModularity = modularity.getQuality(plm.getPartition(), G);
+
+    ParallelLeiden leiden(G);
+    leiden.run();
+    Partition zeta = leiden.getPartition();
+    const double leidenModularity = modularity.getQuality(zeta, G);
+
+    DEBUG("number of clusters: " , zeta.numberOfSubsets());
+    DEBUG("modularity: ", leidenModularity, " (PLM: ", plmModularity, ")");
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+    EXPECT_GE(leidenModularity, plmModularity - 0.01);
+    EXPECT_GE(leiden.numberOfIterations(), 1);
+    EXPECT_LE(leiden.numberOfIterations(), 3);
+
+    // all communities are connected
+    UnionFind uf(G.upperNodeIdBound());
+    G.forEdges([&](node u, node v) {
+        if (zeta[u] == zeta[v])
+            uf.merge(u, v);
+    });
+    std::set<index> components;
+    G.forNodes([&](node u) { components.insert(uf.find(u)); });
+    EXPECT_EQ(components.size(), zeta.numberOfSubsets());
+}
+
+TEST_F(CommunityGTest, testParallelLeidenCPM) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator graphGen(100, 5, 1.0, 0.0);
+    Graph G = graphGen.generate();
+    const Partition groundTruth = graphGen.getCommunities();
+    // connect the cliques sparsely
+    for (node u = 0; u < 100; u += 10)
+        if (!G.hasEdge(u, (u + 37) % 100))
+            G.addEdge(u, (u + 37) % 100);
+
+    for (bool randomize : {true, false}) {
+        ParallelLeiden leiden(G, 0.5, ParallelLeiden::cpm, 3, randomize);
+        leiden.run();
+        Partition zeta = leiden.getPartition();
+        EXPECT_EQ(zeta.numberOfSubsets(), 5);
+        EXPECT_TRUE(GraphClusteringTools::equalClusterings(zeta, groundTruth, G));
+    }
+
+    // a resolution above the maximum density yields singletons
+    ParallelLeiden singletons(G, 1.5, ParallelLeiden::cpm);
+    singletons.run();
+    EXPECT_EQ(singletons.getPartition().numberOfSubsets(), G.numberOfNodes());
+}
+
+TEST_F(CommunityGTest, testDynPLM) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ClusteredRandomGraphGenerator(500, 10, 0.3, 0.005).generate();
+    Modularity modularity;
+
+    DynPLM dynPlm(G);
+    dynPlm.run();
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, dynPlm.getPartition()));
+
+    for (int batchIdx = 0; batchIdx < 5; ++batchIdx) {
+        std::vector<GraphEvent> batch;
+        for (int i = 0; i < 20; ++i) {
+            const node u = GraphTools::randomNode(G), v = GraphTools::randomNode(G);
+            if (u != v && !G.hasEdge(u, v)) {
+                G.addEdge(u, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+            }
+            const auto e = GraphTools::randomEdge(G);
+            G.removeEdge(e.first, e.second);
+            batch.emplace_back(GraphEvent::EDGE_REMOVAL, e.first, e.second);
+        }
+        const node x = G.addNode();
+        batch.emplace_back(GraphEvent::NODE_ADDITION, x);
+        for (int i = 0; i < 5; ++i) {
+            const node v = GraphTools::randomNode(G);
+            if (v != x && !G.hasEdge(x, v)) {
+                G.addEdge(x, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, x, v);
+            }
+        }
+
+        dynPlm.updateBatch(batch);
+        const Partition zeta = dynPlm.getPartition();
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+        EXPECT_LT(dynPlm.numberOfVisitedNodes(), G.numberOfNodes());
+
+        PLM plm(G);
+        plm.run();
+        EXPECT_GE(modularity.getQuality(zeta, G),
+                  modularity.getQuality(plm.getPartition(), G) - 0.05);
+    }
+}
+
+TEST_F(CommunityGTest, testDynPLMMergesCommunities) {
+    // two 10-cliques that are connected by a single edge
+    Graph G(20);
+    for (node u = 0; u < 20; ++u)
+        for (node v = u + 1; v < 20; ++v)
+            if (u / 10 == v / 10)
+                G.addEdge(u, v);
+    G.addEdge(0, 10);
+
+    DynPLM dynPlm(G);
+    dynPlm.run();
+    Partition zeta = dynPlm.getPartition();
+    EXPECT_EQ(zeta.numberOfSubsets(), 2);
+    EXPECT_NE(zeta[0], zeta[10]);
+
+    // connect the cliques completely
+    std::vector<GraphEvent> batch;
+    for (node u = 0; u < 10; ++u)
+        for (node v = 10; v < 20; ++v)
+            if (!G.hasEdge(u, v)) {
+                G.addEdge(u, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+            }
+    dynPlm.updateBatch(batch);
+    zeta = dynPlm.getPartition();
+    EXPECT_EQ(zeta.numberOfSubsets(), 1);
+
+    // a new node that is attached to a clique joins it
+    const node x = G.addNode();
+    dynPlm.update(GraphEvent(GraphEvent::NODE_ADDITION, x));
+    for (node v = 0; v < 5; ++v) {
+        G.addEdge(x, v);
+        dynPlm.update(GraphEvent(GraphEvent::EDGE_ADDITION, x, v));
+    }
+    zeta = dynPlm.getPartition();
+    EXPECT_EQ(zeta[x], zeta[0]);
+
+    // removing a node keeps the partition proper
+    std::vector<GraphEvent> removal;
+    for (node v = 0; v < 5; ++v) {
+        G.removeEdge(x, v);
+        removal.emplace_back(GraphEvent::EDGE_REMOVAL, x, v);
+    }
+    G.removeNode(x);
+    removal.emplace_back(GraphEvent::NODE_REMOVAL, x);
+    dynPlm.updateBatch(removal);
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, dynPlm.getPartition()));
+}
+
+TEST_F(CommunityGTest, testDynPLMReusesCommunityIds) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ClusteredRandomGraphGenerator(100, 4, 0.5, 0.01).generate();
+    DynPLM dynPlm(G);
+    dynPlm.run();
+    const index initialBound = dynPlm.getPartition().upperBound();
+
+    // Every round adds a node that joins a community and removes it again.
+    for (count round = 0; round < 50; ++round) {
+        const node x = G.addNode();
+        std::vector<GraphEvent> batch{GraphEvent(GraphEvent::NODE_ADDITION, x)};
+        for (count i = 0; i < 5; ++i) {
+            const node v = GraphTools::randomNode(G);
+            if (v != x && !G.hasEdge(x, v)) {
+                G.addEdge(x, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, x, v);
+            }
+        }
+        dynPlm.updateBatch(batch);
+
+        batch.clear();
+        G.forNeighborsOf(x, [&](node v) { batch.emplace_back(GraphEvent::EDGE_REMOVAL, x, v); });
+        G.removeNode(x);
+        batch.emplace_back(GraphEvent::NODE_REMOVAL, x);
+        dynPlm.updateBatch(batch);
+
+        const Partition &zeta = dynPlm.getPartition();
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+        EXPECT_LE(zeta.upperBound(), initialBound + 2);
+    }
+}
+
+TEST_F(CommunityGTest, testDynPLMRequiresEdgeRemovalsBeforeNodeRemoval) {
+    Graph G(6);
+    for (node u = 0; u < 3; ++u)
+        for (node v = u + 1; v < 3; ++v) {
+            G.addEdge(u, v);
+            G.addEdge(u + 3, v + 3);
+        }
+    G.addEdge(2, 3);
+
+    DynPLM dynPlm(G);
+    dynPlm.run();
+    const Partition before = dynPlm.getPartition();
+
+    // The edges of node 3 vanish without events.
+    G.removeNode(3);
+    EXPECT_THROW(dynPlm.update(GraphEvent(GraphEvent::NODE_REMOVAL, 3)), std::runtime_error);
+    EXPECT_EQ(dynPlm.getPartition().getVector(), before.getVector());
+
+    // Restore the graph that dynPlm still knows; with the events of the removed edges, the
+    // volumes of the neighbors are updated.
+    G.restoreNode(3);
+    G.addEdge(2, 3);
+    G.addEdge(3, 4);
+    G.addEdge(3, 5);
+    std::vector<GraphEvent> batch;
+    G.forNeighborsOf(3, [&](node v) { batch.emplace_back(GraphEvent::EDGE_REMOVAL, 3, v); });
+    G.removeNode(3);
+    batch.emplace_back(GraphEvent::NODE_REMOVAL, 3);
+    dynPlm.updateBatch(batch);
+
+    const Partition zeta = dynPlm.getPartition();
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+    EXPECT_EQ(zeta[3], none);
+    EXPECT_EQ(zeta[4], zeta[5]);
+    EXPECT_NE(zeta[0], zeta[4]);
+}
+
+TEST_F(CommunityGTest, testDynPLMWithGraphDifference) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ClusteredRandomGraphGenerator(200, 5, 0.3, 0.01).generate();
+    DynPLM dynPlm(G);
+    dynPlm.run();
+
+    // G2 lacks some nodes of G and has new nodes with gaps in their ids, so GraphDifference
+    // adds and removes placeholder nodes.
+    Graph G2(G);
+    for (node u = 0; u < 10; ++u)
+        G2.removeNode(3 * u);
+    for (count i = 0; i < 6; ++i)
+        G2.addNode();
+    for (node u = G.upperNodeIdBound(); u < G2.upperNodeIdBound(); u += 2)
+        G2.removeNode(u);
+    G2.forNodes([&](node u) {
+        if (u >= G.upperNodeIdBound())
+            for (node v = 1; v < 6; ++v)
+                if (G2.hasNode(v))
+                    G2.addEdge(u, v);
+    });
+
+    GraphDifference diff(G, G2);
+    diff.run();
+    const std::vector<GraphEvent> edits = diff.getEdits();
+    GraphUpdater(G).update(edits);
+    ASSERT_EQ(G.upperNodeIdBound(), G2.upperNodeIdBound());
+    dynPlm.updateBatch(edits);
+
+    const Partition zeta = dynPlm.getPartition();
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+    G.forNodes([&](node u) { EXPECT_NE(zeta[u], none); });
+    for (node u = 0; u < G.upperNodeIdBound(); ++u)
+        if (!G.hasNode(u))
+            EXPECT_EQ(zeta[u], none);
+
+    Modularity modularity;
+    PLM plm(G);
+    plm.run();
+    EXPECT_GE(modularity.getQuality(zeta, G),
+              modularity.getQuality(plm.getPartition(), G) - 0.05);
+}
+
 TEST_F(CommunityGTest, testModularity) {
 
     count n = 100;
@@ -502,6 +804,91 @@ TEST_F(CommunityGTest, testClusteringIntersection) {
     }
 }
 
+TEST_F(CommunityGTest, testContingencyTable) {
+    Aux::Random::setSeed(42, false);
+    const count n = 1000;
+    Graph G(n);
+    G.removeNode(3);
+
+    Partition zeta(n), eta(n + 5);
+    zeta.setUpperBound(30);
+    eta.setUpperBound(20);
+    for (node u = 0; u < n; ++u) {
+        zeta[u] = Aux::Random::integer(29);
+        eta[u] = Aux::Random::integer(19);
+    }
+    zeta[7] = none;
+    eta[n + 2] = 4;
+
+    // Reference counts over the nodes of G that are assigned in both partitions.
+    std::map<std::pair<index, index>, count> expected;
+    std::vector<count> sizeZeta(30, 0), sizeEta(20, 0);
+    G.forNodes([&](node u) {
+        if (zeta[u] == none)
+            return;
+        ++expected[{zeta[u], eta[u]}];
+        ++sizeZeta[zeta[u]];
+        ++sizeEta[eta[u]];
+    });
+
+    const ContingencyTable table(G, zeta, eta);
+    EXPECT_EQ(n - 2, table.numberOfElements());
+    EXPECT_EQ(sizeZeta, table.firstSizes());
+    EXPECT_EQ(sizeEta, table.secondSizes());
+    ASSERT_EQ(expected.size(), table.numberOfEntries());
+
+    index i = 0;
+    count pairs = 0;
+    for (const auto &cell : expected) {
+        EXPECT_EQ(cell.first.first, table.firstSubset(i));
+        EXPECT_EQ(cell.first.second, table.secondSubset(i));
+        EXPECT_EQ(cell.second, table.entrySize(i));
+        pairs += cell.second * (cell.second - 1) / 2;
+        ++i;
+    }
+    EXPECT_EQ(pairs, table.pairsInEntries());
+
+    G.forNodes([&](node u) {
+        if (zeta[u] == none) {
+            EXPECT_EQ(none, table.entryOf(u));
+        } else {
+            const index e = table.entryOf(u);
+            EXPECT_EQ(zeta[u], table.firstSubset(e));
+            EXPECT_EQ(eta[u], table.secondSubset(e));
+        }
+    });
+    EXPECT_EQ(none, table.entryOf(3));
+    EXPECT_EQ(none, table.entryOf(n + 2));
+
+    // Without a graph, all elements that are assigned in both partitions are counted.
+    const ContingencyTable full(zeta, eta);
+    EXPECT_EQ(n - 1, full.numberOfElements());
+    EXPECT_NE(none, full.entryOf(3));
+    EXPECT_EQ(none, full.entryOf(n + 2));
+
+    const Partition intersection = PartitionIntersection().calculate(zeta, eta);
+    EXPECT_EQ(n + 5, intersection.numberOfElements());
+    EXPECT_EQ(full.numberOfEntries(), intersection.numberOfSubsets());
+    for (node u = 0; u < n + 5; ++u)
+        EXPECT_EQ(full.entryOf(u), intersection[u]);
+}
+
+TEST_F(CommunityGTest, testPartitionIntersectionSparseIds) {
+    // The upper bound of the ids is far larger than the number of elements.
+    Partition zeta(6), eta(6);
+    zeta.setUpperBound(1000000000);
+    eta.setUpperBound(3);
+    for (index e = 0; e < 6; ++e) {
+        zeta[e] = e < 3 ? 0 : 999999999;
+        eta[e] = e % 2;
+    }
+    eta[5] = none;
+
+    const Partition intersection = PartitionIntersection().calculate(zeta, eta);
+    EXPECT_EQ(std::vector<index>({0, 1, 0, 3, 2, none}), intersection.getVector());
+    EXPECT_EQ(4u, intersection.upperBound());
+}
+
 TEST_F(CommunityGTest, testMakeNoncontinuousClustering) {
     ClusteringGenerator generator;
     // make complete graph
@@ -652,6 +1039,235 @@ TEST_F(CommunityGTest, testPartitionFragmentation) {
     EXPECT_DOUBLE_EQ(0.9, frag3.getWeightedAverage());
 }
 
+TEST_F(CommunityGTest, testPartitionQualityEvaluation) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator gen(300, 6, 0.1, 0.01);
+    Graph G(gen.generate(), true, false);
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real(0.5, 2.0)); });
+    G.addEdge(3, 3, 1.5);
+    G.removeNode(7);
+
+    PLM plm(G);
+    plm.run();
+    Partition zeta = plm.getPartition();
+    // Leave a gap in the subset ids.
+    zeta.setUpperBound(zeta.upperBound() + 1);
+    G.forNodes([&](node u) {
+        if (zeta[u] > 0)
+            zeta[u] += 1;
+    });
+
+    PartitionQualityEvaluation eval(G, zeta);
+    eval.run();
+
+    EXPECT_NEAR(Modularity().getQuality(zeta, G),
+                eval.getValue(PartitionQualityEvaluation::MODULARITY), 1e-9);
+    EXPECT_NEAR(Coverage().getQuality(zeta, G),
+                eval.getValue(PartitionQualityEvaluation::COVERAGE), 1e-9);
+    EXPECT_NEAR(EdgeCut().getQuality(zeta, G),
+                eval.getValue(PartitionQualityEvaluation::EDGE_CUT), 1e-9);
+    EXPECT_EQ(zeta.numberOfSubsets(), eval.numberOfClusters());
+
+    Graph unweighted(G, false, false);
+    IntrapartitionDensity density(unweighted, zeta);
+    density.run();
+    EXPECT_DOUBLE_EQ(density.getGlobal(),
+                     eval.getValue(PartitionQualityEvaluation::INTRAPARTITION_DENSITY));
+
+    PartitionHubDominance hub(G, zeta);
+    hub.run();
+    PartitionFragmentation fragmentation(G, zeta);
+    fragmentation.run();
+    const auto sizes = zeta.subsetSizeMap();
+    for (const auto &idAndSize : sizes) {
+        const index c = idAndSize.first;
+        EXPECT_EQ(idAndSize.second, eval.getClusterSizes()[c]);
+        EXPECT_DOUBLE_EQ(
+            density.getValue(c),
+            eval.getClusterValues(PartitionQualityEvaluation::INTRAPARTITION_DENSITY)[c]);
+        EXPECT_DOUBLE_EQ(hub.getValue(c),
+                         eval.getClusterValues(PartitionQualityEvaluation::HUB_DOMINANCE)[c]);
+        EXPECT_DOUBLE_EQ(fragmentation.getValue(c),
+                         eval.getClusterValues(PartitionQualityEvaluation::FRAGMENTATION)[c]);
+    }
+    EXPECT_DOUBLE_EQ(hub.getUnweightedAverage(),
+                     eval.getValue(PartitionQualityEvaluation::HUB_DOMINANCE));
+    EXPECT_DOUBLE_EQ(fragmentation.getUnweightedAverage(),
+                     eval.getValue(PartitionQualityEvaluation::FRAGMENTATION));
+
+    // For bipartitions, the maximum cluster conductance is the conductance of the cut.
+    Graph simple(unweighted);
+    simple.removeSelfLoops();
+    Partition bipartition(simple.upperNodeIdBound());
+    bipartition.setUpperBound(2);
+    simple.forNodes([&](node u) { bipartition[u] = u % 3 == 0; });
+    PartitionQualityEvaluation cut(simple, bipartition,
+                                   {PartitionQualityEvaluation::CONDUCTANCE});
+    cut.run();
+    EXPECT_NEAR(Conductance().getQuality(bipartition, simple),
+                cut.getValue(PartitionQualityEvaluation::CONDUCTANCE), 1e-9);
+    EXPECT_THROW(cut.getValue(PartitionQualityEvaluation::MODULARITY), std::runtime_error);
+}
+
+TEST_F(CommunityGTest, testPartitionQualityEvaluationWithoutClusters) {
+    const std::vector<PartitionQualityEvaluation::Measure> perCluster{
+        PartitionQualityEvaluation::EDGE_CUT, PartitionQualityEvaluation::CONDUCTANCE,
+        PartitionQualityEvaluation::INTRAPARTITION_DENSITY,
+        PartitionQualityEvaluation::HUB_DOMINANCE, PartitionQualityEvaluation::FRAGMENTATION};
+
+    // Empty graph and empty partition.
+    Graph empty;
+    Partition emptyPartition;
+    PartitionQualityEvaluation emptyEval(empty, emptyPartition, perCluster);
+    emptyEval.run();
+    EXPECT_EQ(0u, emptyEval.numberOfClusters());
+    for (const auto m : perCluster)
+        EXPECT_EQ(0.0, emptyEval.getValue(m));
+
+    // All nodes unassigned.
+    Graph G(5);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    Partition unassigned(5);
+    PartitionQualityEvaluation eval(G, unassigned);
+    eval.run();
+    EXPECT_EQ(0u, eval.numberOfClusters());
+    EXPECT_EQ(0.0, eval.getValue(PartitionQualityEvaluation::COVERAGE));
+    for (const auto m : perCluster)
+        EXPECT_EQ(0.0, eval.getValue(m));
+
+    // Only singletons.
+    Partition singletons(5);
+    singletons.allToSingletons();
+    PartitionQualityEvaluation singletonEval(G, singletons, perCluster);
+    singletonEval.run();
+    EXPECT_EQ(5u, singletonEval.numberOfClusters());
+    EXPECT_EQ(1.0, singletonEval.getValue(PartitionQualityEvaluation::INTRAPARTITION_DENSITY));
+}
+
+TEST_F(CommunityGTest, testEgoSplittingOverlappingCliques) {
+    // Three cliques of size 10; node 9 belongs to the first two, node 18 to the last two.
+    Graph G(28);
+    auto addClique = [&](node first) {
+        for (node u = first; u < first + 10; ++u)
+            for (node v = u + 1; v < first + 10; ++v)
+                G.addEdge(u, v);
+    };
+    addClique(0);
+    addClique(9);
+    addClique(18);
+
+    EgoSplitting ego(G);
+    ego.run();
+    const Cover &cover = ego.getCover();
+
+    EXPECT_EQ(30u, ego.numberOfPersonas());
+    EXPECT_EQ(G.numberOfEdges(), ego.getPersonaGraph().numberOfEdges());
+    EXPECT_EQ(2u, cover[9].size());
+    EXPECT_EQ(2u, cover[18].size());
+    EXPECT_EQ(3u, cover.numberOfSubsets());
+    G.forNodes([&](node u) {
+        if (u != 9 && u != 18)
+            EXPECT_EQ(1u, cover[u].size());
+        for (node v = 0; v < 28; ++v)
+            if (v / 10 == u / 10 && u % 10 != 9 && v % 10 != 9)
+                EXPECT_TRUE(cover.inSameSubset(u, v));
+    });
+    EXPECT_TRUE(cover.inSameSubset(9, 0));
+    EXPECT_TRUE(cover.inSameSubset(9, 10));
+    EXPECT_TRUE(cover.inSameSubset(18, 10));
+    EXPECT_TRUE(cover.inSameSubset(18, 27));
+}
+
+TEST_F(CommunityGTest, testEgoSplittingPersonaGraph) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator gen(400, 8, 0.2, 0.005);
+    Graph G = gen.generate();
+    G.removeNode(5);
+
+    EgoSplitting ego(G, EgoSplitting::Clustering::PLM, EgoSplitting::Clustering::PLP);
+    ego.run();
+    const Graph &personas = ego.getPersonaGraph();
+    const auto &personaNode = ego.getPersonaNodes();
+
+    // The persona graph is a lift of G: every edge maps to exactly one edge between personas.
+    EXPECT_EQ(G.numberOfEdges(), personas.numberOfEdges());
+    EXPECT_GE(ego.numberOfPersonas(), G.numberOfNodes());
+    personas.forEdges(
+        [&](node p, node q) { EXPECT_TRUE(G.hasEdge(personaNode[p], personaNode[q])); });
+
+    std::vector<count> numPersonas(G.upperNodeIdBound(), 0);
+    for (const node u : personaNode)
+        ++numPersonas[u];
+    const Cover &cover = ego.getCover();
+    G.forNodes([&](node u) {
+        EXPECT_GE(numPersonas[u], 1u);
+        EXPECT_GE(cover[u].size(), 1u);
+        EXPECT_LE(cover[u].size(), numPersonas[u]);
+    });
+    EXPECT_EQ(0u, numPersonas[5]);
+    EXPECT_TRUE(cover[5].empty());
+}
+
+TEST_F(CommunityGTest, testStreamingClusteringPath) {
+    StreamingClustering streaming(2);
+    streaming.addEdge(0, 1);
+    // The community of 0 and 1 has volume 3 > 2 and does not grow anymore.
+    streaming.addEdge(1, 2);
+    streaming.addEdge(2, 3);
+    EXPECT_EQ(3u, streaming.numberOfEdges());
+    EXPECT_EQ(4u, streaming.upperNodeIdBound());
+
+    Partition zeta = streaming.getPartition();
+    EXPECT_EQ(4u, zeta.numberOfElements());
+    EXPECT_EQ(2u, zeta.numberOfSubsets());
+    EXPECT_TRUE(zeta.inSameSubset(0, 1));
+    EXPECT_TRUE(zeta.inSameSubset(2, 3));
+    EXPECT_FALSE(zeta.inSameSubset(1, 2));
+}
+
+TEST_F(CommunityGTest, testStreamingClusteringInputs) {
+    StreamingClustering fromFile(5);
+    fromFile.readEdgeList("input/spaceseparated_weighted.edgelist", ' ', 1);
+
+    StreamingClustering fromEvents(5);
+    fromEvents.updateBatch({GraphEvent(GraphEvent::NODE_ADDITION, 0),
+                            GraphEvent(GraphEvent::EDGE_ADDITION, 0, 1, 2),
+                            GraphEvent(GraphEvent::EDGE_ADDITION, 0, 2, 4),
+                            GraphEvent(GraphEvent::TIME_STEP),
+                            GraphEvent(GraphEvent::EDGE_ADDITION, 1, 2, 3)});
+
+    EXPECT_EQ(3u, fromFile.numberOfEdges());
+    EXPECT_EQ(3u, fromEvents.numberOfEdges());
+    EXPECT_EQ(fromFile.getPartition().getVector(), fromEvents.getPartition().getVector());
+    EXPECT_THROW(fromEvents.update(GraphEvent(GraphEvent::EDGE_WEIGHT_UPDATE, 0, 1, 1.0)),
+                 std::runtime_error);
+}
+
+TEST_F(CommunityGTest, testStreamingClusteringRefinement) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator gen(500, 10, 0.3, 0.002);
+    Graph G = gen.generate();
+
+    std::vector<std::pair<node, node>> edges;
+    G.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+    std::shuffle(edges.begin(), edges.end(), Aux::Random::getURNG());
+
+    StreamingClustering streaming(2.0 * G.numberOfEdges() / 10);
+    for (const auto &edge : edges)
+        streaming.addEdge(edge.first, edge.second);
+    EXPECT_EQ(G.numberOfEdges(), streaming.numberOfEdges());
+
+    Modularity modularity;
+    const Partition zeta = streaming.getPartition();
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+    EXPECT_GT(modularity.getQuality(zeta, G), 0.3);
+
+    const Partition refined = streaming.refine(G);
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, refined));
+    EXPECT_GE(modularity.getQuality(refined, G) + 1e-9, modularity.getQuality(zeta, G));
+}
+
 TEST_F(CommunityGTest, testCoverF1Similarity) {
     count n = 20;
     Graph G(n);
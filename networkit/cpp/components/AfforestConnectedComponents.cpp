@@ -0,0 +1,82 @@
+/*
+ * AfforestConnectedComponents.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <unordered_map>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/components/AfforestConnectedComponents.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/structures/ConcurrentUnionFind.hpp>
+
+namespace NetworKit {
+
+AfforestConnectedComponents::AfforestConnectedComponents(const Graph &G, count neighborRounds,
+                                                         count sampleSize)
+    : ComponentDecomposition(G), neighborRounds(neighborRounds), sampleSize(sampleSize) {
+    if (G.isDirected())
+        throw std::runtime_error(
+            "Error, connected components of directed graphs cannot be "
+            "computed, use StronglyConnectedComponents or WeaklyConnectedComponents instead.");
+}
+
+void AfforestConnectedComponents::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+
+    // Roots are linked below smaller ids, so every tree is represented by its smallest node.
+    ConcurrentUnionFind forest(z);
+
+    // Sampling phase: link the first neighborRounds edges of every node.
+    for (index r = 0; r < neighborRounds; ++r) {
+        G->parallelForNodes([&](node u) {
+            const node v = G->getIthNeighbor(u, r);
+            if (v != none)
+                forest.unite(u, v);
+        });
+        forest.compress();
+    }
+    handler.assureRunning();
+
+    // The most frequent label among the sampled nodes is most likely the largest component.
+    node largest = none;
+    if (G->numberOfNodes() > 0) {
+        std::unordered_map<node, count> frequency;
+        count maxFrequency = 0;
+        for (index i = 0; i < sampleSize; ++i) {
+            const node u = GraphTools::randomNode(*G);
+            const node label = forest.find(u);
+            const count f = ++frequency[label];
+            if (f > maxFrequency) {
+                maxFrequency = f;
+                largest = label;
+            }
+        }
+    }
+
+    // Finish phase: link the remaining edges of all nodes outside of the largest component. Each
+    // edge between a node of the largest component and another node is linked from the other
+    // node, since the graph is undirected.
+    G->balancedParallelForNodes([&](node u) {
+        if (forest.find(u) == largest)
+            return;
+        const count deg = G->degree(u);
+        for (index i = neighborRounds; i < deg; ++i)
+            forest.unite(u, G->getIthNeighbor(u, i));
+    });
+    forest.compress();
+    handler.assureRunning();
+
+    component = Partition(z);
+    component.setUpperBound(z);
+    G->parallelForNodes([&](node u) { component[u] = forest.find(u); });
+    component.compact();
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,249 @@
+/*
+ * DynHDTConnectedComponents.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+
+#include <networkit/components/DynHDTConnectedComponents.hpp>
+#include <networkit/structures/UnionFind.hpp>
+
+namespace NetworKit {
+
+DynHDTConnectedComponents::DynHDTConnectedComponents(const Graph &G) : G(&G), numTreeEdges(0) {
+    if (G.isDirected())
+        throw std::runtime_error("Error, connected components of directed graphs cannot be "
+                                 "computed, use StronglyConnectedComponents instead.");
+}
+
+void DynHDTConnectedComponents::run() {
+    const count z = G->upperNodeIdBound();
+    forests.clear();
+    forests.emplace_back(z);
+    edges.clear();
+    nonTree.clear();
+    nonTree.resize(z);
+    numTreeEdges = 0;
+
+    std::vector<Edge> batch;
+    batch.reserve(G->numberOfEdges());
+    G->forEdges([&](node u, node v) { batch.emplace_back(u, v, true); });
+    insertEdges(batch);
+
+    hasRun = true;
+}
+
+void DynHDTConnectedComponents::update(GraphEvent e) {
+    updateBatch({e});
+}
+
+void DynHDTConnectedComponents::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+    addNodes();
+
+    // Process maximal runs of insertions and of deletions.
+    std::vector<Edge> run;
+    for (index i = 0; i < batch.size();) {
+        const auto type = batch[i].type;
+        if (type != GraphEvent::EDGE_ADDITION && type != GraphEvent::EDGE_REMOVAL) {
+            ++i;
+            continue;
+        }
+        run.clear();
+        for (; i < batch.size() && batch[i].type == type; ++i)
+            run.emplace_back(batch[i].u, batch[i].v, true);
+        if (type == GraphEvent::EDGE_ADDITION)
+            insertEdges(run);
+        else
+            removeEdges(run);
+    }
+}
+
+void DynHDTConnectedComponents::addNodes() {
+    const count z = G->upperNodeIdBound();
+    if (z <= nonTree.size())
+        return;
+    for (auto &forest : forests)
+        forest.addNodes(z);
+    nonTree.resize(z);
+}
+
+void DynHDTConnectedComponents::ensureLevel(count level) {
+    while (forests.size() <= level)
+        forests.emplace_back(nonTree.size());
+}
+
+void DynHDTConnectedComponents::insertEdges(const std::vector<Edge> &batch) {
+    std::vector<Edge> inserted;
+    for (const Edge &e : batch) {
+        if (e.u == e.v)
+            continue;
+        auto it = edges.find(e);
+        if (it != edges.end())
+            ++it->second.multiplicity;
+        else {
+            edges.emplace(e, EdgeInfo{});
+            inserted.push_back(e);
+        }
+    }
+
+    // Look up the trees of the endpoints in parallel, then select a spanning forest of the trees
+    // and the inserted edges; its edges become tree edges.
+    const EulerTourForest &forest = forests.front();
+    std::vector<index> trees(2 * inserted.size());
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(inserted.size()); ++i) {
+        trees[2 * i] = forest.treeOf(inserted[i].u);
+        trees[2 * i + 1] = forest.treeOf(inserted[i].v);
+    }
+    std::vector<index> ids(trees);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(trees.size()); ++i)
+        trees[i] = std::lower_bound(ids.begin(), ids.end(), trees[i]) - ids.begin();
+
+    UnionFind treeUnion(ids.size());
+    for (index i = 0; i < inserted.size(); ++i) {
+        const node u = inserted[i].u, v = inserted[i].v;
+        EdgeInfo &info = edges.at(inserted[i]);
+        if (treeUnion.find(trees[2 * i]) != treeUnion.find(trees[2 * i + 1])) {
+            treeUnion.merge(trees[2 * i], trees[2 * i + 1]);
+            info.tree = true;
+            addTreeEdge(u, v, 0);
+        } else {
+            addNonTreeEdge(u, v, info, 0);
+        }
+    }
+}
+
+void DynHDTConnectedComponents::removeEdges(const std::vector<Edge> &batch) {
+    // Non-tree edges cannot disconnect a component; removing them first ensures that no edge of
+    // the batch is chosen as a replacement.
+    std::vector<Edge> treeEdges;
+    for (const Edge &e : batch) {
+        auto it = edges.find(e);
+        if (it == edges.end() || --it->second.multiplicity > 0)
+            continue;
+        if (it->second.tree) {
+            treeEdges.push_back(e);
+        } else {
+            removeNonTreeEdge(e.u, e.v, it->second);
+            edges.erase(it);
+        }
+    }
+
+    for (const Edge &e : treeEdges) {
+        auto it = edges.find(e);
+        const count level = it->second.level;
+        edges.erase(it);
+        for (count i = 0; i <= level; ++i)
+            forests[i].cut(e.u, e.v);
+        --numTreeEdges;
+        replace(e.u, e.v, level);
+    }
+}
+
+void DynHDTConnectedComponents::addTreeEdge(node u, node v, count level) {
+    ensureLevel(level);
+    for (count i = 0; i <= level; ++i)
+        forests[i].link(u, v);
+    forests[level].markEdge(u, v, true);
+    ++numTreeEdges;
+}
+
+void DynHDTConnectedComponents::addNonTreeEdge(node u, node v, EdgeInfo &info, count level) {
+    ensureLevel(level);
+    info.tree = false;
+    info.level = level;
+    const node endpoints[2] = {std::min(u, v), std::max(u, v)};
+    for (index k = 0; k < 2; ++k) {
+        const node a = endpoints[k];
+        if (nonTree[a].size() <= level)
+            nonTree[a].resize(level + 1);
+        auto &list = nonTree[a][level];
+        info.position[k] = list.size();
+        list.push_back(endpoints[1 - k]);
+        if (list.size() == 1)
+            forests[level].markNode(a, true);
+    }
+}
+
+void DynHDTConnectedComponents::removeNonTreeEdge(node u, node v, EdgeInfo &info) {
+    const node endpoints[2] = {std::min(u, v), std::max(u, v)};
+    for (index k = 0; k < 2; ++k) {
+        const node a = endpoints[k];
+        auto &list = nonTree[a][info.level];
+        const index pos = info.position[k];
+        const node moved = list.back();
+        list[pos] = moved;
+        list.pop_back();
+        if (pos < list.size())
+            edges.at(Edge(a, moved, true)).position[a < moved ? 0 : 1] = pos;
+        if (list.empty())
+            forests[info.level].markNode(a, false);
+    }
+}
+
+void DynHDTConnectedComponents::replace(node u, node v, count level) {
+    ensureLevel(level + 1);
+    for (count i = level + 1; i-- > 0;) {
+        EulerTourForest &forest = forests[i];
+        const node small = forest.treeSize(u) <= forest.treeSize(v) ? u : v;
+
+        // The smaller tree has at most half the size, so its edges can move up one level.
+        for (const Edge &e : forest.markedEdges(small)) {
+            edges.at(e).level = i + 1;
+            forest.markEdge(e.u, e.v, false);
+            forests[i + 1].link(e.u, e.v);
+            forests[i + 1].markEdge(e.u, e.v, true);
+        }
+
+        // Every non-tree edge of level i at the smaller tree either reconnects the trees or has
+        // both endpoints in the smaller tree and moves up one level.
+        for (node w : forest.markedNodes(small)) {
+            while (nonTree[w].size() > i && !nonTree[w][i].empty()) {
+                const node x = nonTree[w][i].back();
+                EdgeInfo &info = edges.at(Edge(w, x, true));
+                removeNonTreeEdge(w, x, info);
+                if (!forest.connected(x, small)) {
+                    info.tree = true;
+                    info.level = i;
+                    addTreeEdge(w, x, i);
+                    return;
+                }
+                addNonTreeEdge(w, x, info, i + 1);
+            }
+        }
+    }
+}
+
+std::map<index, count> DynHDTConnectedComponents::getComponentSizes() const {
+    assureFinished();
+    std::map<index, count> result;
+    G->forNodes([&](node u) {
+        if (forests.front().smallestNode(u) == u)
+            result[u] = forests.front().treeSize(u);
+    });
+    return result;
+}
+
+std::vector<std::vector<node>> DynHDTConnectedComponents::getComponents() const {
+    assureFinished();
+    std::vector<index> componentIndex(G->upperNodeIdBound(), none);
+    std::vector<std::vector<node>> result;
+    G->forNodes([&](node u) {
+        const node c = forests.front().smallestNode(u);
+        if (componentIndex[c] == none) {
+            componentIndex[c] = result.size();
+            result.emplace_back();
+        }
+        result[componentIndex[c]].push_back(u);
+    });
+    return result;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,329 @@
+/*
+ * ParallelBiconnectedComponents.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <omp.h>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/components/ParallelBiconnectedComponents.hpp>
+#include <networkit/structures/ConcurrentUnionFind.hpp>
+
+namespace NetworKit {
+
+ParallelBiconnectedComponents::ParallelBiconnectedComponents(const Graph &G) : G(&G) {
+    if (G.isDirected())
+        throw std::runtime_error(
+            "Error, biconnected components cannot be computed on directed graphs.");
+}
+
+void ParallelBiconnectedComponents::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+    const int numThreads = omp_get_max_threads();
+    std::vector<std::vector<node>> buffers(numThreads);
+
+    auto gather = [&](std::vector<node> &out) {
+        out.clear();
+        for (auto &buffer : buffers) {
+            out.insert(out.end(), buffer.begin(), buffer.end());
+            buffer.clear();
+        }
+    };
+
+    // The smallest node of every connected component is the root of its spanning tree.
+    std::vector<node> frontier;
+    {
+        ConcurrentUnionFind forest(z);
+        G->parallelForEdges([&](node u, node v) { forest.unite(u, v); });
+#pragma omp parallel
+        {
+            auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(static)
+            for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+                if (G->hasNode(u) && forest.find(u) == static_cast<index>(u))
+                    local.push_back(u);
+        }
+        gather(frontier);
+    }
+    handler.assureRunning();
+
+    // Level-synchronous BFS. The parent of a node is its smallest neighbor on the previous level,
+    // which makes the forest independent of the number of threads.
+    std::unique_ptr<std::atomic<count>[]> depth(new std::atomic<count>[z]);
+    std::unique_ptr<std::atomic<node>[]> minParent(new std::atomic<node>[z]);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        depth[u].store(none, std::memory_order_relaxed);
+        minParent[u].store(none, std::memory_order_relaxed);
+    }
+
+    std::vector<node> order;
+    order.reserve(G->numberOfNodes());
+    std::vector<index> levelOffsets{0};
+    for (node r : frontier)
+        depth[r].store(0, std::memory_order_relaxed);
+
+    for (count level = 1; !frontier.empty(); ++level) {
+        order.insert(order.end(), frontier.begin(), frontier.end());
+        levelOffsets.push_back(order.size());
+#pragma omp parallel
+        {
+            auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                const node u = frontier[i];
+                G->forNeighborsOf(u, [&](node v) {
+                    count d = none;
+                    if (depth[v].compare_exchange_strong(d, level, std::memory_order_relaxed))
+                        local.push_back(v);
+                    else if (d != level)
+                        return;
+                    node p = minParent[v].load(std::memory_order_relaxed);
+                    while (u < p && !minParent[v].compare_exchange_weak(p, u))
+                        ;
+                });
+            }
+        }
+        gather(frontier);
+    }
+    const count numLevels = levelOffsets.size() - 1;
+    handler.assureRunning();
+
+    // Children in CSR format, sorted by id.
+    parent.assign(z, none);
+    childOffsets.assign(z + 1, 0);
+    {
+        std::unique_ptr<std::atomic<index>[]> cursor(new std::atomic<index>[z + 1] {});
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i) {
+            const node v = order[i];
+            parent[v] = minParent[v].load(std::memory_order_relaxed);
+            if (parent[v] != none)
+                cursor[parent[v] + 1].fetch_add(1, std::memory_order_relaxed);
+        }
+        for (index u = 0; u < z; ++u) {
+            childOffsets[u + 1] = childOffsets[u] + cursor[u + 1].load(std::memory_order_relaxed);
+            cursor[u].store(childOffsets[u], std::memory_order_relaxed);
+        }
+
+        children.resize(childOffsets[z]);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i) {
+            const node v = order[i];
+            if (parent[v] != none)
+                children[cursor[parent[v]].fetch_add(1, std::memory_order_relaxed)] = v;
+        }
+    }
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        std::sort(children.begin() + childOffsets[u], children.begin() + childOffsets[u + 1]);
+
+    auto forChildren = [&](node u, auto handle) {
+        for (index i = childOffsets[u]; i < childOffsets[u + 1]; ++i)
+            handle(children[i]);
+    };
+
+    // Calls handle(u) in parallel for all nodes of the levels in the given order.
+    auto forLevels = [&](bool bottomUp, auto handle) {
+        for (index l = 0; l < numLevels; ++l) {
+            const index level = bottomUp ? numLevels - 1 - l : l;
+#pragma omp parallel for schedule(guided)
+            for (omp_index i = static_cast<omp_index>(levelOffsets[level]);
+                 i < static_cast<omp_index>(levelOffsets[level + 1]); ++i)
+                handle(order[i]);
+        }
+    };
+
+    // Subtree sizes bottom-up, then preorder numbers top-down.
+    std::vector<count> size(z, 0);
+    forLevels(true, [&](node u) {
+        count s = 1;
+        forChildren(u, [&](node c) { s += size[c]; });
+        size[u] = s;
+    });
+
+    std::vector<index> pre(z, none);
+    index nextPre = 0;
+    for (index i = 0; i < levelOffsets[1]; ++i) {
+        pre[order[i]] = nextPre;
+        nextPre += size[order[i]];
+    }
+    forLevels(false, [&](node u) {
+        index p = pre[u] + 1;
+        forChildren(u, [&](node c) {
+            pre[c] = p;
+            p += size[c];
+        });
+    });
+
+    // low/high: extreme preorder numbers adjacent to the subtree, without the tree edge to the
+    // parent. A parallel edge to the parent counts as a non-tree edge.
+    std::vector<index> low(z, none), high(z, none);
+    forLevels(true, [&](node u) {
+        index lo = pre[u], hi = pre[u];
+        bool skipParent = parent[u] != none;
+        G->forNeighborsOf(u, [&](node w) {
+            if (w == u)
+                return;
+            if (skipParent && w == parent[u]) {
+                skipParent = false;
+                return;
+            }
+            lo = std::min(lo, pre[w]);
+            hi = std::max(hi, pre[w]);
+        });
+        forChildren(u, [&](node c) {
+            lo = std::min(lo, low[c]);
+            hi = std::max(hi, high[c]);
+        });
+        low[u] = lo;
+        high[u] = hi;
+    });
+    handler.assureRunning();
+
+    auto isAncestor = [&](node a, node b) {
+        return pre[a] <= pre[b] && pre[b] < pre[a] + size[a];
+    };
+
+    // Tree edges are identified by their lower endpoint.
+    ConcurrentUnionFind treeEdges(z);
+    G->balancedParallelForNodes([&](node v) {
+        const node u = parent[v];
+        if (u == none)
+            return;
+        if (parent[u] != none && (low[v] < pre[u] || high[v] >= pre[u] + size[u]))
+            treeEdges.unite(v, u);
+        G->forNeighborsOf(v, [&](node w) {
+            if (v < w && !isAncestor(v, w) && !isAncestor(w, v))
+                treeEdges.unite(v, w);
+        });
+    });
+    handler.assureRunning();
+
+    // Number the components in the order of their representatives, i.e., of their smallest
+    // lower endpoint.
+    edgeComponent.assign(z, none);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i) {
+        const node v = order[i];
+        if (parent[v] != none)
+            edgeComponent[v] = treeEdges.find(v);
+    }
+    std::vector<index> componentId(z, 0);
+    for (node v : order)
+        if (edgeComponent[v] == v)
+            componentId[v] = 1;
+    count numComponents = 0;
+    for (index v = 0; v < z; ++v) {
+        const index used = componentId[v];
+        componentId[v] = numComponents;
+        numComponents += used;
+    }
+
+    // The tree edges of a component form a subtree, so the component consists of their lower
+    // endpoints and the parent of its topmost node, which is stored first.
+    offsets.assign(numComponents + 1, 0);
+    std::unique_ptr<std::atomic<index>[]> cursor(new std::atomic<index>[numComponents + 1] {});
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i) {
+        const node v = order[i];
+        if (parent[v] == none)
+            continue;
+        edgeComponent[v] = componentId[edgeComponent[v]];
+        cursor[edgeComponent[v] + 1].fetch_add(1, std::memory_order_relaxed);
+    }
+    for (index c = 0; c < numComponents; ++c) {
+        offsets[c + 1] = offsets[c] + cursor[c + 1].load(std::memory_order_relaxed) + 1;
+        cursor[c].store(offsets[c] + 1, std::memory_order_relaxed);
+    }
+
+    members.resize(offsets[numComponents]);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i) {
+        const node u = order[i];
+        if (parent[u] != none)
+            members[cursor[edgeComponent[u]].fetch_add(1, std::memory_order_relaxed)] = u;
+        forChildren(u, [&](node v) {
+            if (edgeComponent[v] != edgeComponent[u])
+                members[offsets[edgeComponent[v]]] = u;
+        });
+    }
+#pragma omp parallel for schedule(guided)
+    for (omp_index c = 0; c < static_cast<omp_index>(numComponents); ++c)
+        std::sort(members.begin() + offsets[c], members.begin() + offsets[c + 1]);
+    handler.assureRunning();
+
+    // A node is an articulation point if its tree edges are in more than one component.
+    articulation.assign(z, 0);
+    G->parallelForNodes([&](node u) {
+        index c = edgeComponent[u];
+        forChildren(u, [&](node v) {
+            if (c == none)
+                c = edgeComponent[v];
+            else if (edgeComponent[v] != c)
+                articulation[u] = 1;
+        });
+    });
+
+    // (parent[v], v) is a bridge if no other edge leaves the subtree of v.
+    std::vector<std::vector<Edge>> localBridges(numThreads);
+    G->parallelForNodes([&](node v) {
+        if (parent[v] != none && low[v] >= pre[v] && high[v] < pre[v] + size[v])
+            localBridges[omp_get_thread_num()].emplace_back(parent[v], v, true);
+    });
+    bridges.clear();
+    for (auto &local : localBridges)
+        bridges.insert(bridges.end(), local.begin(), local.end());
+    std::sort(bridges.begin(), bridges.end(), [](const Edge &e1, const Edge &e2) {
+        return e1.u < e2.u || (e1.u == e2.u && e1.v < e2.v);
+    });
+
+    hasRun = true;
+}
+
+std::vector<count> ParallelBiconnectedComponents::getComponentSizes() const {
+    assureFinished();
+    std::vector<count> sizes(numberOfComponents());
+    for (index c = 0; c < sizes.size(); ++c)
+        sizes[c] = offsets[c + 1] - offsets[c];
+    return sizes;
+}
+
+std::vector<std::vector<node>> ParallelBiconnectedComponents::getComponents() const {
+    assureFinished();
+    std::vector<std::vector<node>> result(numberOfComponents());
+    for (index c = 0; c < result.size(); ++c)
+        result[c].assign(members.begin() + offsets[c], members.begin() + offsets[c + 1]);
+    return result;
+}
+
+std::vector<index> ParallelBiconnectedComponents::getComponentsOfNode(node u) const {
+    assureFinished();
+    std::vector<index> result;
+    if (edgeComponent[u] != none)
+        result.push_back(edgeComponent[u]);
+    for (index i = childOffsets[u]; i < childOffsets[u + 1]; ++i)
+        result.push_back(edgeComponent[children[i]]);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::vector<node> ParallelBiconnectedComponents::getArticulationPoints() const {
+    assureFinished();
+    std::vector<node> result;
+    G->forNodes([&](node u) {
+        if (articulation[u])
+            result.push_back(u);
+    });
+    return result;
+}
+
+} // namespace NetworKit
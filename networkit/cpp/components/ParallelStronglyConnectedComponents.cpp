@@ -0,0 +1,331 @@
+/*
+ * ParallelStronglyConnectedComponents.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <omp.h>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/components/ParallelStronglyConnectedComponents.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Appends the per-thread buffers to out and clears them.
+void gather(std::vector<std::vector<node>> &buffers, std::vector<node> &out) {
+    out.clear();
+    for (auto &buffer : buffers) {
+        out.insert(out.end(), buffer.begin(), buffer.end());
+        buffer.clear();
+    }
+}
+
+// Level-synchronous parallel BFS from the nodes of frontier along the out-edges (or the in-edges
+// if InEdges is true). The edge (u, v) is followed if claim(u, v) returns true, which must return
+// true at most once for every v.
+template <bool InEdges, typename Claim>
+void parallelSearch(const Graph &G, std::vector<node> frontier, Claim claim) {
+    std::vector<std::vector<node>> next(omp_get_max_threads());
+    while (!frontier.empty()) {
+#pragma omp parallel
+        {
+            auto &local = next[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                const node u = frontier[i];
+                auto visit = [&](node v) {
+                    if (claim(u, v))
+                        local.push_back(v);
+                };
+                if (InEdges)
+                    G.forInNeighborsOf(u, visit);
+                else
+                    G.forNeighborsOf(u, visit);
+            }
+        }
+        gather(next, frontier);
+    }
+}
+
+} // namespace
+
+ParallelStronglyConnectedComponents::ParallelStronglyConnectedComponents(const Graph &G)
+    : ComponentDecomposition(G) {
+
+    if (!G.isDirected())
+        WARN("The input graph is undirected, use ConnectedComponents for more efficiency.");
+}
+
+void ParallelStronglyConnectedComponents::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+    const int numThreads = omp_get_max_threads();
+
+    // Every component is labeled by one of its nodes; the labels are compacted at the end.
+    component.reset(z, none);
+    auto finished = [&](node u) { return component[u] != none; };
+
+    // Nodes are claimed by writing the number of the current search into their stamp.
+    std::unique_ptr<std::atomic<index>[]> stamp(new std::atomic<index>[z]);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        stamp[u].store(none, std::memory_order_relaxed);
+    index searches = 0;
+    auto claim = [&](node v, index search) {
+        return stamp[v].exchange(search, std::memory_order_relaxed) != search;
+    };
+
+    std::vector<node> active;
+    active.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) { active.push_back(u); });
+
+    std::vector<std::vector<node>> buffers(numThreads);
+
+    // Removes the finished nodes from the active nodes.
+    auto removeFinished = [&]() {
+#pragma omp parallel
+        {
+            auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(static)
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+                if (!finished(active[i]))
+                    local.push_back(active[i]);
+        }
+        gather(buffers, active);
+    };
+
+    // Trim-1: a node without unfinished in- or out-neighbors is a component of its own. Only the
+    // neighbors of trimmed nodes can become trimmable, so they are the candidates of the next
+    // round.
+    auto hasUnfinishedNeighbor = [&](node u, bool inEdges) {
+        bool found = false;
+        auto check = [&](node v) { found = found || (v != u && !finished(v)); };
+        if (inEdges)
+            G->forInNeighborsOf(u, check);
+        else
+            G->forNeighborsOf(u, check);
+        return found;
+    };
+
+    std::vector<node> trimmed;
+    auto trim1 = [&]() {
+        std::vector<node> candidates = active;
+        while (!candidates.empty()) {
+#pragma omp parallel
+            {
+                auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(candidates.size()); ++i) {
+                    const node u = candidates[i];
+                    if (!finished(u)
+                        && (!hasUnfinishedNeighbor(u, true) || !hasUnfinishedNeighbor(u, false)))
+                        local.push_back(u);
+                }
+            }
+            gather(buffers, trimmed);
+
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(trimmed.size()); ++i)
+                component[trimmed[i]] = trimmed[i];
+
+            const index search = searches++;
+#pragma omp parallel
+            {
+                auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(trimmed.size()); ++i) {
+                    auto enqueue = [&](node v) {
+                        if (!finished(v) && claim(v, search))
+                            local.push_back(v);
+                    };
+                    G->forNeighborsOf(trimmed[i], enqueue);
+                    G->forInNeighborsOf(trimmed[i], enqueue);
+                }
+            }
+            gather(buffers, candidates);
+        }
+        removeFinished();
+    };
+
+    // Trim-2: if v is the only unfinished in-neighbor of u and u the only one of v (or likewise
+    // for out-neighbors), u and v form a component.
+    auto uniqueUnfinishedNeighbor = [&](node u, bool inEdges) {
+        node unique = none;
+        bool several = false;
+        auto check = [&](node v) {
+            if (v == u || finished(v) || v == unique)
+                return;
+            several = several || unique != none;
+            unique = v;
+        };
+        if (inEdges)
+            G->forInNeighborsOf(u, check);
+        else
+            G->forNeighborsOf(u, check);
+        return several ? none : unique;
+    };
+
+    auto trim2 = [&]() {
+        std::vector<node> label(active.size(), none);
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+            const node u = active[i];
+            for (bool inEdges : {true, false}) {
+                const node v = uniqueUnfinishedNeighbor(u, inEdges);
+                if (v != none && uniqueUnfinishedNeighbor(v, inEdges) == u) {
+                    label[i] = std::min(u, v);
+                    break;
+                }
+            }
+        }
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+            if (label[i] != none)
+                component[active[i]] = label[i];
+        removeFinished();
+    };
+
+    trim1();
+    trim2();
+    trim1();
+    handler.assureRunning();
+
+    // Forward-backward search from the node with the largest product of in- and out-degree.
+    if (!active.empty()) {
+        auto score = [&](node u) { return G->degreeIn(u) * G->degreeOut(u); };
+        node pivot = active.front();
+#pragma omp parallel
+        {
+            node best = active.front();
+#pragma omp for schedule(static) nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+                if (score(active[i]) > score(best))
+                    best = active[i];
+#pragma omp critical
+            if (score(best) > score(pivot) || (score(best) == score(pivot) && best < pivot))
+                pivot = best;
+        }
+
+        const index forward = searches++, backward = searches++;
+        stamp[pivot].store(forward, std::memory_order_relaxed);
+        parallelSearch<false>(*G, {pivot}, [&](node, node v) {
+            return !finished(v) && claim(v, forward);
+        });
+
+        // The nodes that are reached by both searches form the component of the pivot.
+        stamp[pivot].store(backward, std::memory_order_relaxed);
+        component[pivot] = pivot;
+        parallelSearch<true>(*G, {pivot}, [&](node, node v) {
+            index expected = forward;
+            if (!stamp[v].compare_exchange_strong(expected, backward, std::memory_order_relaxed))
+                return false;
+            component[v] = pivot;
+            return true;
+        });
+        removeFinished();
+        handler.assureRunning();
+    }
+
+    // Coloring of the remaining nodes. Finished nodes have the color none.
+    std::unique_ptr<std::atomic<node>[]> color(new std::atomic<node>[z]);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        color[u].store(none, std::memory_order_relaxed);
+
+    while (!active.empty()) {
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+            color[active[i]].store(active[i], std::memory_order_relaxed);
+
+        // Propagate the largest color along the out-edges; only nodes whose color has increased
+        // propagate again in the next round.
+        std::vector<node> frontier = active;
+        while (!frontier.empty()) {
+            const index search = searches++;
+#pragma omp parallel
+            {
+                auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    const node u = frontier[i];
+                    const node c = color[u].load(std::memory_order_relaxed);
+                    G->forNeighborsOf(u, [&](node v) {
+                        node cv = color[v].load(std::memory_order_relaxed);
+                        while (cv != none && cv < c) {
+                            if (color[v].compare_exchange_weak(cv, c, std::memory_order_relaxed)) {
+                                if (claim(v, search))
+                                    local.push_back(v);
+                                break;
+                            }
+                        }
+                    });
+                }
+            }
+            gather(buffers, frontier);
+        }
+
+        // Every root r is the largest node of its component, which consists of the nodes of color
+        // r that reach r.
+        std::vector<node> roots;
+#pragma omp parallel
+        {
+            auto &local = buffers[omp_get_thread_num()];
+#pragma omp for schedule(static)
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+                if (color[active[i]].load(std::memory_order_relaxed) == active[i])
+                    local.push_back(active[i]);
+        }
+        gather(buffers, roots);
+
+        const index search = searches++;
+        for (node r : roots) {
+            stamp[r].store(search, std::memory_order_relaxed);
+            component[r] = r;
+        }
+        parallelSearch<true>(*G, roots, [&](node w, node v) {
+            const node c = color[w].load(std::memory_order_relaxed);
+            if (color[v].load(std::memory_order_relaxed) != c || !claim(v, search))
+                return false;
+            component[v] = c;
+            return true;
+        });
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i)
+            if (finished(active[i]))
+                color[active[i]].store(none, std::memory_order_relaxed);
+        removeFinished();
+        handler.assureRunning();
+    }
+
+    // Relabel every component by its smallest node, so that compacting numbers the components in
+    // the order of their smallest node.
+    std::unique_ptr<std::atomic<node>[]> smallest(new std::atomic<node>[z]);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(z); ++i)
+        smallest[i].store(none, std::memory_order_relaxed);
+    G->parallelForNodes([&](node u) {
+        std::atomic<node> &s = smallest[component[u]];
+        node current = s.load(std::memory_order_relaxed);
+        while (u < current && !s.compare_exchange_weak(current, u, std::memory_order_relaxed)) {
+        }
+    });
+    G->parallelForNodes([&](node u) {
+        component[u] = smallest[component[u]].load(std::memory_order_relaxed);
+    });
+
+    component.setUpperBound(z);
+    component.compact();
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
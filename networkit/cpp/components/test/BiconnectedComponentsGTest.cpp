@@ -5,12 +5,15 @@
  *     Author: Eugenio Angriman
  */
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
 #include <networkit/components/BiconnectedComponents.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
+#include <networkit/components/ParallelBiconnectedComponents.hpp>
 #include <networkit/graph/GraphTools.hpp>
 
 namespace NetworKit {
@@ -57,4 +60,87 @@ TEST_F(BiconnectedComponentsGTest, testBiconnectedComponents) {
     }
 }
 
+TEST_F(BiconnectedComponentsGTest, testParallelBiconnectedComponentsTiny) {
+    Graph G(11, false, false);
+    G.removeNode(10);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    G.addEdge(1, 3);
+    G.addEdge(1, 4);
+    G.addEdge(0, 5);
+    G.addEdge(0, 6);
+    G.addEdge(4, 5);
+    G.addEdge(2, 3);
+    G.addEdge(6, 8);
+    G.addEdge(6, 7);
+    G.addEdge(7, 8);
+    ParallelBiconnectedComponents bc(G);
+    bc.run();
+
+    EXPECT_EQ(bc.numberOfComponents(), 4);
+    // Ordered by the smallest node except the topmost one: 1, 2, 6 and 7.
+    const std::vector<std::vector<node>> expected{{0, 1, 4, 5}, {1, 2, 3}, {0, 6}, {6, 7, 8}};
+    EXPECT_EQ(bc.getComponents(), expected);
+    EXPECT_EQ(bc.getComponentSizes(), std::vector<count>({4, 3, 2, 3}));
+    EXPECT_EQ(bc.getComponentsOfNode(0), std::vector<index>({0, 2}));
+    EXPECT_TRUE(bc.getComponentsOfNode(9).empty());
+    EXPECT_EQ(bc.getArticulationPoints(), std::vector<node>({0, 1, 6}));
+
+    ASSERT_EQ(bc.getBridges().size(), 1);
+    EXPECT_EQ(bc.getBridges()[0].u, 0);
+    EXPECT_EQ(bc.getBridges()[0].v, 6);
+}
+
+TEST_F(BiconnectedComponentsGTest, testParallelBiconnectedComponents) {
+    auto numberOfConnectedComponents = [](const Graph &G) {
+        ConnectedComponents cc(G);
+        cc.run();
+        return cc.numberOfComponents();
+    };
+
+    for (int seed : {1, 2, 3}) {
+        Aux::Random::setSeed(seed, false);
+        for (double p : {0.01, 0.02, 0.05}) {
+            Graph G = ErdosRenyiGenerator(200, p, false).generate();
+
+            BiconnectedComponents sequential(G);
+            sequential.run();
+            ParallelBiconnectedComponents parallel(G);
+            parallel.run();
+
+            // Same components, up to their order.
+            auto expected = sequential.getComponents();
+            for (auto &component : expected)
+                std::sort(component.begin(), component.end());
+            std::sort(expected.begin(), expected.end());
+            auto actual = parallel.getComponents();
+            std::sort(actual.begin(), actual.end());
+            EXPECT_EQ(actual, expected);
+
+            const count numComponents = numberOfConnectedComponents(G);
+            G.forNodes([&](node u) {
+                Graph G1(G);
+                const count isolated = G1.degree(u) == 0;
+                G1.removeNode(u);
+                EXPECT_EQ(parallel.isArticulationPoint(u),
+                          numberOfConnectedComponents(G1) + isolated > numComponents);
+            });
+
+            count numBridges = 0;
+            G.forEdges([&](node u, node v) {
+                Graph G1(G);
+                G1.removeEdge(u, v);
+                numBridges += numberOfConnectedComponents(G1) > numComponents;
+            });
+            EXPECT_EQ(parallel.getBridges().size(), numBridges);
+            for (const Edge &e : parallel.getBridges()) {
+                EXPECT_LT(e.u, e.v);
+                Graph G1(G);
+                G1.removeEdge(e.u, e.v);
+                EXPECT_GT(numberOfConnectedComponents(G1), numComponents);
+            }
+        }
+    }
+}
+
 } // namespace NetworKit
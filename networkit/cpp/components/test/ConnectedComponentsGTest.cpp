@@ -5,11 +5,16 @@
 *      Author: Maximilian Vogel
 */
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
 
+#include <networkit/components/AfforestConnectedComponents.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/components/ParallelConnectedComponents.hpp>
+#include <networkit/components/ParallelStronglyConnectedComponents.hpp>
 #include <networkit/components/StronglyConnectedComponents.hpp>
 #include <networkit/components/DynConnectedComponents.hpp>
+#include <networkit/components/DynHDTConnectedComponents.hpp>
 #include <networkit/components/DynWeaklyConnectedComponents.hpp>
 #include <networkit/components/WeaklyConnectedComponents.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
@@ -22,6 +27,7 @@
 #include <networkit/io/KONECTGraphReader.hpp>
 #include <networkit/generators/HavelHakimiGenerator.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/generators/DorogovtsevMendesGenerator.hpp>
 
 namespace NetworKit {
@@ -118,6 +124,51 @@ TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsWithDeletedNodes
 
 }
 
+TEST_F(ConnectedComponentsGTest, testAfforestConnectedComponents) {
+    METISGraphReader reader;
+    std::vector<std::string> graphs = {"PGPgiantcompo", "celegans_metabolic", "hep-th", "jazz",
+                                       "astro-ph"};
+
+    for (const auto &graphName : graphs) {
+        Graph G = reader.read("input/" + graphName + ".graph");
+        ConnectedComponents cc(G);
+        cc.run();
+        for (count rounds : {0, 2}) {
+            AfforestConnectedComponents afforest(G, rounds);
+            afforest.run();
+            EXPECT_EQ(cc.numberOfComponents(), afforest.numberOfComponents());
+            EXPECT_EQ(cc.getPartition().getVector(), afforest.getPartition().getVector());
+        }
+    }
+}
+
+TEST_F(ConnectedComponentsGTest, testAfforestConnectedComponentsLongPaths) {
+    // Two long paths, an isolated node and a deleted node; the node ids are shuffled such that the paths do not
+    // follow the id order.
+    const count n = 20000;
+    std::vector<node> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), Aux::Random::getURNG());
+    Graph G(n);
+    for (index i = 0; i + 2 < n; i += 2) {
+        G.addEdge(perm[i], perm[i + 2]);
+        G.addEdge(perm[i + 1], perm[i + 3]);
+    }
+    G.removeNode(G.addNode());
+    G.addNode();
+
+    ConnectedComponents cc(G);
+    cc.run();
+    EXPECT_EQ(3u, cc.numberOfComponents());
+
+    AfforestConnectedComponents afforest(G);
+    afforest.run();
+    EXPECT_EQ(3u, afforest.numberOfComponents());
+    EXPECT_EQ(cc.getPartition().getVector(), afforest.getPartition().getVector());
+    EXPECT_EQ(cc.getComponentSizes(), afforest.getComponentSizes());
+    EXPECT_THROW(AfforestConnectedComponents(Graph(5, false, true)), std::runtime_error);
+}
+
 TEST_F(ConnectedComponentsGTest, benchConnectedComponents) {
     // construct graph
     METISGraphReader reader;
@@ -251,6 +302,79 @@ TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponents) {
     }
 }
 
+TEST_F(ConnectedComponentsGTest, testParallelStronglyConnectedComponentsIds) {
+    // Two 3-cycles, the first one reaches the second one; the first one contains the largest node.
+    Graph G(6, false, true);
+    G.addEdge(0, 1);
+    G.addEdge(1, 5);
+    G.addEdge(5, 0);
+    G.addEdge(2, 3);
+    G.addEdge(3, 4);
+    G.addEdge(4, 2);
+    G.addEdge(5, 2);
+
+    ParallelStronglyConnectedComponents pscc(G);
+    pscc.run();
+    EXPECT_EQ(pscc.getPartition().getVector(), std::vector<index>({0, 0, 1, 1, 1, 0}));
+}
+
+TEST_F(ConnectedComponentsGTest, testParallelStronglyConnectedComponents) {
+    // Both algorithms must find the same components; the ids may differ.
+    auto compare = [](const Graph &G) {
+        StronglyConnectedComponents scc(G);
+        scc.run();
+        ParallelStronglyConnectedComponents pscc(G);
+        pscc.run();
+
+        EXPECT_EQ(pscc.numberOfComponents(), scc.numberOfComponents());
+        std::vector<index> idMap(scc.numberOfComponents(), none);
+        G.forNodes([&](node u) {
+            const index expected = scc.componentOfNode(u);
+            const index actual = pscc.componentOfNode(u);
+            ASSERT_LT(actual, pscc.numberOfComponents());
+            if (idMap[expected] == none)
+                idMap[expected] = actual;
+            EXPECT_EQ(idMap[expected], actual);
+        });
+
+        // The components are numbered in the order of their smallest node.
+        index nextId = 0;
+        G.forNodes([&](node u) {
+            const index c = pscc.componentOfNode(u);
+            if (c == nextId)
+                ++nextId;
+            EXPECT_LT(c, nextId);
+        });
+    };
+
+    for (int seed : {1, 2, 3}) {
+        Aux::Random::setSeed(seed, false);
+        for (double p : {0.002, 0.005, 0.01, 0.05}) {
+            Graph G = ErdosRenyiGenerator(500, p, true).generate();
+            compare(G);
+
+            // Deleted nodes must not be assigned to a component.
+            for (node u = 0; u < 500; u += 7)
+                G.removeNode(u);
+            compare(G);
+        }
+    }
+
+    // Long paths and cycles, which are handled by the trimming and the coloring.
+    Graph G(1500, false, true);
+    for (node u = 0; u + 1 < 500; ++u)
+        G.addEdge(u, u + 1);
+    for (node u = 500; u + 1 < 1500; ++u)
+        if (u != 999)
+            G.addEdge(u + 1, u);
+    G.addEdge(500, 999);
+    G.addEdge(1000, 1499);
+    G.addEdge(999, 1200);
+    G.addEdge(499, 750);
+    G.addEdge(300, 300);
+    compare(G);
+}
+
 TEST_F(ConnectedComponentsGTest, testDynConnectedComponentsTiny) {
     // construct graph
     Graph g;
@@ -390,6 +514,73 @@ TEST_F(ConnectedComponentsGTest, testDynConnectedComponents) {
 }
 
 
+TEST_F(ConnectedComponentsGTest, testDynHDTConnectedComponents) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.02, false).generate();
+    DynHDTConnectedComponents dcc(G);
+    dcc.run();
+
+    // Components are identified by their smallest node.
+    auto check = [&]() {
+        ConnectedComponents cc(G);
+        cc.run();
+        EXPECT_EQ(dcc.numberOfComponents(), cc.numberOfComponents());
+        std::vector<node> smallest(cc.numberOfComponents(), none);
+        G.forNodes([&](node u) {
+            const index c = cc.componentOfNode(u);
+            smallest[c] = std::min(smallest[c], u);
+        });
+        G.forNodes([&](node u) {
+            EXPECT_EQ(dcc.componentOfNode(u), smallest[cc.componentOfNode(u)]);
+            EXPECT_EQ(dcc.componentSize(u), cc.getComponentSizes()[cc.componentOfNode(u)]);
+        });
+        EXPECT_EQ(dcc.getComponents().size(), cc.numberOfComponents());
+    };
+    check();
+
+    auto randomEdgeEvent = [&](bool insertion) {
+        node u, v;
+        if (insertion) {
+            do {
+                u = GraphTools::randomNode(G);
+                v = GraphTools::randomNode(G);
+            } while (u == v || G.hasEdge(u, v));
+            G.addEdge(u, v);
+            return GraphEvent(GraphEvent::EDGE_ADDITION, u, v);
+        }
+        std::tie(u, v) = GraphTools::randomEdge(G);
+        G.removeEdge(u, v);
+        return GraphEvent(GraphEvent::EDGE_REMOVAL, u, v);
+    };
+
+    // Single updates.
+    for (index i = 0; i < 300; ++i) {
+        dcc.update(randomEdgeEvent(Aux::Random::real() < 0.4));
+        if (i % 50 == 0)
+            check();
+    }
+    check();
+
+    // Interleaved batches that mostly delete edges, which splits the giant component.
+    for (index i = 0; i < 20; ++i) {
+        std::vector<GraphEvent> batch;
+        for (index j = 0; j < 30 && G.numberOfEdges() > 0; ++j)
+            batch.push_back(randomEdgeEvent(Aux::Random::real() < 0.2));
+        dcc.updateBatch(batch);
+        check();
+    }
+
+    // Batches that only insert edges, including new nodes.
+    for (index i = 0; i < 5; ++i) {
+        const node added = G.addNode();
+        std::vector<GraphEvent> batch{GraphEvent(GraphEvent::NODE_ADDITION, added)};
+        for (index j = 0; j < 50; ++j)
+            batch.push_back(randomEdgeEvent(true));
+        dcc.updateBatch(batch);
+        check();
+    }
+}
+
 TEST_F(ConnectedComponentsGTest, testWeaklyConnectedComponentsTiny) {
     // construct graph
     Graph g(0, false, true);
@@ -7,7 +7,9 @@
 
 #include <algorithm>
 #include <ctime>
+#include <functional>
 #include <memory>
+#include <omp.h>
 #include <queue>
 #include <unordered_set>
 
@@ -178,9 +180,118 @@ void DynAPSP::update(GraphEvent event) {
 }
 
 void DynAPSP::updateBatch(const std::vector<GraphEvent>& batch) {
-  for(auto e : batch){
-    update(e);
-  }
+    visitedPairs = 0;
+    // inserted edges, in both directions if G is undirected
+    std::vector<WeightedEdge> arcs;
+    for (const GraphEvent& event : batch) {
+        if (!(event.type==GraphEvent::EDGE_ADDITION || (event.type==GraphEvent::EDGE_WEIGHT_INCREMENT && event.w < 0))) {
+            throw std::runtime_error("event type not allowed. Edge insertions and edge weight decreases only.");
+        }
+        const edgeweight w = G.weight(event.u, event.v);
+        arcs.emplace_back(event.u, event.v, w);
+        if (!G.isDirected()) {
+            arcs.emplace_back(event.v, event.u, w);
+        }
+    }
+
+    // phase 1: find the sources s with distances[s][v] > distances[s][u] + w(u, v) for every
+    // inserted edge (u, v). They form a subtree of the in-tree of shortest paths to u, so they
+    // are found by a pruned backward bfs from u. Only old distances are read in this phase.
+    const count z = G.upperNodeIdBound();
+    const int numThreads = omp_get_max_threads();
+    // pairs of affected source and inserted edge
+    std::vector<std::vector<std::pair<node, index>>> affected(numThreads);
+#pragma omp parallel
+    {
+        auto& local = affected[omp_get_thread_num()];
+        std::vector<bool> visited;
+        std::vector<node> sources;
+#pragma omp for schedule(dynamic)
+        for (omp_index i = 0; i < static_cast<omp_index>(arcs.size()); ++i) {
+            const node u = arcs[i].u;
+            const node v = arcs[i].v;
+            const edgeweight weightuv = arcs[i].weight;
+            if (weightuv >= distances[u][v]) {
+                continue;
+            }
+            visited.resize(z, false);
+            visited[u] = true;
+            sources.assign(1, u);
+            for (index j = 0; j < sources.size(); ++j) {
+                G.forInNeighborsOf(sources[j], [&](node x) {
+                    if (!visited[x] && distances[x][v] > distances[x][u] + weightuv) {
+                        visited[x] = true;
+                        sources.push_back(x);
+                    }
+                });
+            }
+            for (node s : sources) {
+                visited[s] = false;
+                local.emplace_back(s, i);
+            }
+        }
+    }
+
+    // group the inserted edges by affected source
+    std::vector<index> offsets(z + 1, 0);
+    for (const auto& local : affected) {
+        for (const auto& pair : local) {
+            ++offsets[pair.first + 1];
+        }
+    }
+    std::vector<node> sources;
+    for (node s = 0; s < z; ++s) {
+        if (offsets[s + 1] > 0) {
+            sources.push_back(s);
+        }
+        offsets[s + 1] += offsets[s];
+    }
+    std::vector<index> sourceArcs(offsets[z]);
+    {
+        std::vector<index> cursor(offsets.begin(), offsets.end() - 1);
+        for (const auto& local : affected) {
+            for (const auto& pair : local) {
+                sourceArcs[cursor[pair.first]++] = pair.second;
+            }
+        }
+    }
+
+    // phase 2: repair the distances from every affected source with Dijkstra, starting from the
+    // endpoints of the inserted edges. Every thread only writes the rows of its sources.
+    count pairs = 0;
+#pragma omp parallel reduction(+ : pairs)
+    {
+        using DistNode = std::pair<edgeweight, node>;
+        std::priority_queue<DistNode, std::vector<DistNode>, std::greater<DistNode>> heap;
+#pragma omp for schedule(dynamic)
+        for (omp_index i = 0; i < static_cast<omp_index>(sources.size()); ++i) {
+            const node s = sources[i];
+            std::vector<edgeweight>& dist = distances[s];
+            for (index j = offsets[s]; j < offsets[s + 1]; ++j) {
+                const WeightedEdge& arc = arcs[sourceArcs[j]];
+                if (dist[arc.u] + arc.weight < dist[arc.v]) {
+                    dist[arc.v] = dist[arc.u] + arc.weight;
+                    heap.emplace(dist[arc.v], arc.v);
+                }
+            }
+            while (!heap.empty()) {
+                const DistNode top = heap.top();
+                heap.pop();
+                const node x = top.second;
+                if (top.first > dist[x]) {
+                    continue;
+                }
+                ++pairs;
+                G.forNeighborsOf(x, [&](node y, edgeweight weightxy) {
+                    if (dist[x] + weightxy < dist[y]) {
+                        dist[y] = dist[x] + weightxy;
+                        heap.emplace(dist[y], y);
+                    }
+                });
+            }
+        }
+    }
+    visitedPairs = pairs;
 }
 
 count DynAPSP::visPairs() {
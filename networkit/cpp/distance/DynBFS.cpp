@@ -5,16 +5,17 @@
  *      Author: cls, ebergamini
  */
 
+#include <limits>
+#include <omp.h>
+
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/DynBFS.hpp>
-#include <networkit/auxiliary/Log.hpp>
-#include <queue>
 
 
 namespace NetworKit {
 
 DynBFS::DynBFS(const Graph& G, node s, bool storePredecessors) : DynSSSP(G, s, storePredecessors),
-color(G.upperNodeIdBound(), WHITE) {
+stamp(G.upperNodeIdBound(), 0) {
 }
 
 void DynBFS::run() {
@@ -27,12 +28,6 @@ void DynBFS::run() {
         previous.resize(G->upperNodeIdBound());
         G->forNodes([&](node u) { previous[u] = bfs.getPredecessors(u); });
     }
-    maxDistance = 0;
-    G->forNodes([&](node v){
-        if (distances[v] > maxDistance)
-            maxDistance = distances[v];
-    });
-    maxDistance++;
 }
 
 void DynBFS::update(GraphEvent e) {
@@ -43,62 +38,88 @@ void DynBFS::update(GraphEvent e) {
 
 void DynBFS::updateBatch(const std::vector<GraphEvent>& batch) {
     mod = false;
-    std::vector<std::queue<node> > queues(maxDistance);
+    const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+    // frontiers below this size are processed sequentially
+    const count minParallelSize = 256;
 
-    // insert nodes from the batch whose distance has changed (affected nodes) into the queues
+    // seeds[m] contains the nodes that can be reached with m steps through an inserted edge
+    std::vector<std::vector<node>> seeds;
+    auto addSeed = [&](node u, node v) {
+        if (distances[u] == infDist || distances[v] < distances[u] + 1)
+            return;
+        const count level = static_cast<count>(distances[u]) + 1;
+        if (seeds.size() <= level)
+            seeds.resize(level + 1);
+        seeds[level].push_back(v);
+    };
     for (GraphEvent edge : batch) {
         if (edge.type!=GraphEvent::EDGE_ADDITION || edge.w!=1.0)
             throw std::runtime_error("Graph update not allowed");
-        if (distances[edge.u] >= distances[edge.v]+1) {
-            queues[distances[edge.v]+1].push(edge.u);
-        } else if (distances[edge.v] >= distances[edge.u]+1) {
-            queues[distances[edge.u]+1].push(edge.v);
-        }
+        addSeed(edge.u, edge.v);
+        if (!G->isDirected())
+            addSeed(edge.v, edge.u);
     }
 
-    // extract nodes from the queues and scan incident edges
-    std::queue<node> visited;
-    count m = 1;
-    while (m < maxDistance) {
-        DEBUG("m = ", m);
-        while (!queues[m].empty()) {
-            mod = true;
-            node w = queues[m].front();
-            DEBUG("node ", w);
-            queues[m].pop();
-            if (color[w] == BLACK) {
-                continue;
-            }
-            visited.push(w);
-            color[w] = BLACK;
+    // candidates for the next level, found by the threads
+    std::vector<std::vector<node>> buffers(omp_get_max_threads());
+    std::vector<node> frontier;
+
+    auto addToFrontier = [&](node w, count m) {
+        // nodes with a smaller distance have already been processed in an earlier level
+        if (stamp[w] != round && distances[w] >= m) {
+            stamp[w] = round;
+            frontier.push_back(w);
+        }
+    };
+
+    bool candidates = false;
+    for (count m = 1; m < seeds.size() || candidates; ++m) {
+        ++round;
+        frontier.clear();
+        for (auto &buffer : buffers) {
+            for (node w : buffer)
+                addToFrontier(w, m);
+            buffer.clear();
+        }
+        if (m < seeds.size())
+            for (node w : seeds[m])
+                addToFrontier(w, m);
+        candidates = false;
+        if (frontier.empty())
+            continue;
+        mod = true;
+
+        // the distances of the whole level are set first, so that nodes of the same level are
+        // neither predecessors nor candidates of each other
+        for (node w : frontier)
             distances[w] = m;
+
+        const bool parallel = frontier.size() >= minParallelSize;
+#pragma omp parallel for schedule(guided) if (parallel)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+            const node w = frontier[i];
+            auto &buffer = buffers[omp_get_thread_num()];
             if (storePreds) {
                 previous[w].clear();
             }
             npaths[w] = 0;
-            G->forInNeighborsOf(w, [&](node w, node z) {
+            G->forInNeighborsOf(w, [&](node z) {
                 //z is a predecessor for w
-                if (distances[w] == distances[z]+1) {
+                if (distances[w] == distances[z] + 1) {
                     if (storePreds) {
                         previous[w].push_back(z);
                     }
                     npaths[w] += npaths[z];
                 }
+            });
+            G->forNeighborsOf(w, [&](node z) {
                 //w is a predecessor for z
-                else if (color[z] == WHITE && distances[z] >= distances[w]+1 ) {
-                    color[z] = GRAY;
-                    queues[m+1].push(z);
-                }
+                if (distances[z] >= m + 1)
+                    buffer.push_back(z);
             });
         }
-        m = m+1;
-    }
-
-    // reset colors
-    while(!visited.empty()) {
-        node w = visited.front();
-        visited.pop();
-        color[w] = WHITE;
+        for (const auto &buffer : buffers)
+            candidates = candidates || !buffer.empty();
     }
 }
 
@@ -5,9 +5,10 @@
  *      Author: ebergamini
  */
 
-#include <queue>
+#include <algorithm>
+#include <limits>
+#include <omp.h>
 
-#include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/auxiliary/PrioQueue.hpp>
 #include <networkit/distance/Dijkstra.hpp>
@@ -29,6 +30,8 @@ void DynDijkstra::run() {
         previous.resize(G->upperNodeIdBound());
         G->forNodes([&](node u) {previous[u] = dij.getPredecessors(u); });
     }
+    minWeight = std::numeric_limits<edgeweight>::max();
+    G->forEdges([&](node, node, edgeweight w) { minWeight = std::min(minWeight, w); });
 }
 
 void DynDijkstra::update(GraphEvent e) {
@@ -39,19 +42,23 @@ void DynDijkstra::update(GraphEvent e) {
 
 void DynDijkstra::updateBatch(const std::vector<GraphEvent>& batch) {
     mod = false;
+    const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+    // steps with fewer final nodes are processed sequentially
+    const count minParallelSize = 256;
     // priority queue with distance-node pairs
     Aux::PrioQueue<edgeweight, node> Q(G->upperNodeIdBound());
-    // queue with all visited nodes
-    std::queue<node> visited;
-    // if u has a new shortest path going through v, it updates the distance of u
+    // all visited nodes
+    std::vector<node> visited;
+    // if u has a new shortest path of length d, it updates the distance of u
     // and inserts u in the priority queue (or updates its priority, if already in Q)
-    auto updateQueue = [&](node u, node v, edgeweight w) {
-        if (distances[u] >= distances[v]+w) {
-            distances[u] = distances[v]+w;
+    auto updateQueue = [&](node u, edgeweight d) {
+        if (color[u] != BLACK && distances[u] >= d) {
+            distances[u] = d;
             if (color[u] == WHITE) {
                 Q.insert(distances[u], u);
-                color[u] = BLACK;
-            }	else {
+                color[u] = GRAY;
+                visited.push_back(u);
+            } else {
                 Q.changeKey(distances[u], u);
             }
         }
@@ -62,40 +69,62 @@ void DynDijkstra::updateBatch(const std::vector<GraphEvent>& batch) {
             throw std::runtime_error("Graph update not allowed");
         //TODO: discuss with Christian whether you can substitute weight_update with with_increase/weight_decrease
         // otherwise, it is not possbile to check wether the change in the weight is positive or negative
-        updateQueue(edge.u, edge.v, edge.w);
-        updateQueue(edge.v, edge.u, edge.w);
+        minWeight = std::min(minWeight, edge.w);
+        if (distances[edge.u] != infDist)
+            updateQueue(edge.v, distances[edge.u] + edge.w);
+        if (!G->isDirected() && distances[edge.v] != infDist)
+            updateQueue(edge.u, distances[edge.v] + edge.w);
     }
 
+    // distances proposed to the neighbors of the final nodes, found by the threads
+    std::vector<std::vector<std::pair<node, edgeweight>>> buffers(omp_get_max_threads());
+    std::vector<node> current;
     while(Q.size() != 0) {
         mod = true;
-        node current = Q.extractMin().second;
-        visited.push(current);
-        if (storePreds) {
-            previous[current].clear();
-        }
-        npaths[current] = 0;
-        G->forInNeighborsOf(current, [&](node current, node z, edgeweight w){
-            //z is a predecessor of current node
-            if (Aux::NumericTools::equal(distances[current], distances[z]+w, 0.000001)) {
-                if (storePreds) {
-                    previous[current].push_back(z);
-                }
-                npaths[current] += npaths[z];
-            }
-            //check whether curent node is a predecessor of z
-            else {
-                updateQueue(z, current, w);
+        // no queued node can be reached with less than the smallest queued distance plus the
+        // smallest edge weight, so all queued nodes closer than that are final
+        current.clear();
+        const auto first = Q.extractMin();
+        current.push_back(first.second);
+        while (Q.size() != 0 && Q.peekMin().first < first.first + minWeight)
+            current.push_back(Q.extractMin().second);
+        for (node u : current)
+            color[u] = BLACK;
+
+        const bool parallel = current.size() >= minParallelSize;
+#pragma omp parallel for schedule(guided) if (parallel)
+        for (omp_index i = 0; i < static_cast<omp_index>(current.size()); ++i) {
+            const node u = current[i];
+            auto &buffer = buffers[omp_get_thread_num()];
+            if (storePreds) {
+                previous[u].clear();
             }
-        });
+            npaths[u] = 0;
+            G->forInNeighborsOf(u, [&](node z, edgeweight w){
+                //z is a predecessor of u
+                if (Aux::NumericTools::equal(distances[u], distances[z]+w, 0.000001)) {
+                    if (storePreds) {
+                        previous[u].push_back(z);
+                    }
+                    npaths[u] += npaths[z];
+                }
+            });
+            //check whether u is a predecessor of its neighbors
+            G->forNeighborsOf(u, [&](node z, edgeweight w) {
+                if (color[z] != BLACK && distances[z] >= distances[u] + w)
+                    buffer.emplace_back(z, distances[u] + w);
+            });
+        }
+        for (auto &buffer : buffers) {
+            for (const auto &proposal : buffer)
+                updateQueue(proposal.first, proposal.second);
+            buffer.clear();
+        }
     }
 
     // reset colors
-    while(!visited.empty()) {
-        node w = visited.front();
-        visited.pop();
+    for (node w : visited)
         color[w] = WHITE;
-    }
-
 }
 
 } /* namespace NetworKit */
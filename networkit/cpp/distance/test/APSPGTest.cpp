@@ -421,6 +421,47 @@ TEST_F(APSPGTest, testAPSPEventTypeError) {
     EXPECT_ANY_THROW(apsp.update(event3));
 }
 
+TEST_F(APSPGTest, testDynAPSPBatches) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        for (bool weighted : {false, true}) {
+            Graph G(ErdosRenyiGenerator(300, 0.005, directed).generate(), weighted, directed);
+            if (weighted) {
+                G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 10)); });
+            }
+            DynAPSP apsp(G);
+            apsp.run();
+            for (count b = 0; b < 5; ++b) {
+                std::vector<GraphEvent> batch;
+                while (batch.size() < 100) {
+                    const node u = GraphTools::randomNode(G);
+                    const node v = GraphTools::randomNode(G);
+                    if (u == v) {
+                        continue;
+                    }
+                    if (!G.hasEdge(u, v)) {
+                        const edgeweight w = weighted ? Aux::Random::integer(1, 10) : 1;
+                        G.addEdge(u, v, w);
+                        batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v, w);
+                    } else if (weighted && G.weight(u, v) > 1) {
+                        G.increaseWeight(u, v, -1);
+                        batch.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, -1);
+                    }
+                }
+                apsp.updateBatch(batch);
+
+                APSP apsp2(G);
+                apsp2.run();
+                const auto &distances = apsp.getDistances();
+                const auto &distances2 = apsp2.getDistances();
+                G.forNodes([&](node i) {
+                    G.forNodes([&](node j) { EXPECT_EQ(distances[i][j], distances2[i][j]); });
+                });
+            }
+        }
+    }
+}
+
 
 
 } /* namespace NetworKit */
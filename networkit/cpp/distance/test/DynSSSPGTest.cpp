@@ -14,7 +14,10 @@
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/generators/DorogovtsevMendesGenerator.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/graph/GraphTools.hpp>
+#include <algorithm>
 #include <random>
 
 
@@ -290,4 +293,78 @@ TEST_F(DynSSSPGTest, testDynamicDijkstraBatches) {
     });
 }
 
+TEST_F(DynSSSPGTest, testDynamicBFSParallelBatches) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        // sparse enough that some nodes are unreachable at first
+        Graph G = ErdosRenyiGenerator(5000, 0.0003, directed).generate();
+        DynBFS dyn_bfs(G, 0);
+        dyn_bfs.run();
+        for (count b = 0; b < 4; ++b) {
+            std::vector<GraphEvent> batch;
+            while (batch.size() < 1000) {
+                node v1 = GraphTools::randomNode(G);
+                node v2 = GraphTools::randomNode(G);
+                if (v1 != v2 && !G.hasEdge(v1, v2)) {
+                    G.addEdge(v1, v2);
+                    batch.push_back(GraphEvent(GraphEvent::EDGE_ADDITION, v1, v2, 1.0));
+                }
+            }
+            dyn_bfs.updateBatch(batch);
+            BFS bfs(G, 0);
+            bfs.run();
+            G.forNodes([&] (node i) {
+                EXPECT_EQ(dyn_bfs.distance(i), bfs.distance(i));
+                EXPECT_EQ(dyn_bfs.numberOfPaths(i), bfs.numberOfPaths(i));
+                std::vector<node> preds = dyn_bfs.getPredecessors(i);
+                std::vector<node> expected = bfs.getPredecessors(i);
+                std::sort(preds.begin(), preds.end());
+                std::sort(expected.begin(), expected.end());
+                EXPECT_EQ(preds, expected);
+            });
+        }
+    }
+}
+
+TEST_F(DynSSSPGTest, testDynamicDijkstraParallelBatches) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        Graph G(ErdosRenyiGenerator(5000, 0.0003, directed).generate(), true, directed);
+        // small integer weights, so that there are many shortest paths
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 4)); });
+        DynDijkstra dyn_dij(G, 0);
+        dyn_dij.run();
+        for (count b = 0; b < 4; ++b) {
+            std::vector<GraphEvent> batch;
+            while (batch.size() < 1000) {
+                node v1 = GraphTools::randomNode(G);
+                node v2 = GraphTools::randomNode(G);
+                if (v1 == v2)
+                    continue;
+                if (!G.hasEdge(v1, v2)) {
+                    edgeweight w = Aux::Random::integer(1, 4);
+                    G.addEdge(v1, v2, w);
+                    batch.push_back(GraphEvent(GraphEvent::EDGE_ADDITION, v1, v2, w));
+                } else if (G.weight(v1, v2) > 1) {
+                    edgeweight w = G.weight(v1, v2) - 1;
+                    G.setWeight(v1, v2, w);
+                    batch.push_back(GraphEvent(GraphEvent::EDGE_WEIGHT_UPDATE, v1, v2, w));
+                }
+            }
+            dyn_dij.updateBatch(batch);
+            Dijkstra dij(G, 0);
+            dij.run();
+            G.forNodes([&] (node i) {
+                EXPECT_EQ(dyn_dij.distance(i), dij.distance(i));
+                EXPECT_EQ(dyn_dij.numberOfPaths(i), dij.numberOfPaths(i));
+                std::vector<node> preds = dyn_dij.getPredecessors(i);
+                std::vector<node> expected = dij.getPredecessors(i);
+                std::sort(preds.begin(), preds.end());
+                std::sort(expected.begin(), expected.end());
+                EXPECT_EQ(preds, expected);
+            });
+        }
+    }
+}
+
 } /* namespace NetworKit */
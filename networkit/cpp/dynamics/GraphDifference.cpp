@@ -1,6 +1,7 @@
+#include <algorithm>
 #include <string>
+#include <utility>
 
-#include <networkit/auxiliary/Log.hpp>
 #include <networkit/dynamics/GraphDifference.hpp>
 
 namespace NetworKit {
@@ -17,7 +18,7 @@ GraphDifference::GraphDifference(const Graph &G1, const Graph &G2) : G1(&G1), G2
 
 void GraphDifference::run() {
     hasRun = false;
-    edits.clear();
+    editChunks.clear();
     numNodeAdditions = 0;
     numNodeRemovals = 0;
     numNodeRestorations = 0;
@@ -25,17 +26,11 @@ void GraphDifference::run() {
     numEdgeRemovals = 0;
     numWeightUpdates = 0;
 
-    std::vector<bool> marker(G1->upperNodeIdBound(), false);
-    std::vector<edgeweight> neighborWeights(G1->upperNodeIdBound(), 0);
-
-    // collect node events and edge removals/additions in separate vectors
-    // so we can later put them in the right order: first remove edges,
-    // then remove and add nodes and then add edges.
-    std::vector<GraphEvent> nodeEvents, edgeRemovals, edgeAdditions;
-
+    // Node events are cheap to compute, so they are determined sequentially.
+    std::vector<GraphEvent> nodeEvents;
+    const node upperBound = std::max(G1->upperNodeIdBound(), G2->upperNodeIdBound());
     node updatedUpperNodeIdBound = G1->upperNodeIdBound();
-    for (node u = 0; u < G1->upperNodeIdBound() || u < G2->upperNodeIdBound(); ++u) {
-        // First, fix non-common nodes
+    for (node u = 0; u < upperBound; ++u) {
         if (!G2->hasNode(u) && G1->hasNode(u)) {
             nodeEvents.emplace_back(GraphEvent::NODE_REMOVAL, u);
             ++numNodeRemovals;
@@ -58,72 +53,106 @@ void GraphDifference::run() {
                 ++numNodeAdditions;
             }
         }
+    }
 
-        // mark neighbors of current node in G1
-        if (G1->hasNode(u)) {
-            G1->forNeighborsOf(u, [&](node v, edgeweight w) {
-                    if (G1->isDirected() || u <= v) {
-                        TRACE("Marking neighbor of ", u, " in G1 ", v);
-                        marker[v] = true;
-                        neighborWeights[v] = w;
-                    }
-                });
-        }
-
-        // unmark common neighbors, detect edge additions
-        if (G2->hasNode(u)) {
-            G2->forNeighborsOf(u, [&](node v, edgeweight w) {
-                    // for undirected graphs, edges are only added in one direction unless
-                    // the other node does not exist in G1 (edges where both nodes do not
-                    // exist in G1 have been added above).
-                    if (G1->isDirected() || u <= v) {
-                        if (v < G1->upperNodeIdBound() && marker[v]) {
-                            if (neighborWeights[v] != w) {
-                                edgeAdditions.emplace_back(GraphEvent::EDGE_WEIGHT_UPDATE, u, v, w);
-                                ++numWeightUpdates;
-                            }
-                            TRACE("Unmarking neighbor of ", u, " in G2 ", v);
-                            marker[v] = false;
-                        } else {
-                            edgeAdditions.emplace_back(GraphEvent::EDGE_ADDITION, u, v, w);
-                            ++numEdgeAdditions;
-                        }
-                    }
-                });
-        }
-
-        if (G1->hasNode(u)) {
-            // detect edge removals, unset the remaining neighbor markers
-            G1->forNeighborsOf(u, [&](node v) {
-                    TRACE("Checking again (", u, ",", v, ")");
-                    if (G1->isDirected() || u <= v) {
-                        TRACE("Edge (", u, ",", v, ") is considered");
-                        if (marker[v]) {
-                            TRACE("Deleting (", u, ",", v, ")");
-                            edgeRemovals.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
-                            ++numEdgeRemovals;
-                            marker[v] = false;
+    // Edge events are collected per chunk of nodes, so we can later put them
+    // in the right order: first remove edges, then remove and add nodes and
+    // then add edges. Within every group, the chunks keep the order of the nodes.
+    const count chunkSize = 4096;
+    const count numChunks = (upperBound + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<GraphEvent>> edgeRemovals(numChunks), edgeAdditions(numChunks);
+
+    const bool directed = G1->isDirected();
+    count removals = 0, additions = 0, weightUpdates = 0;
+
+#pragma omp parallel reduction(+ : removals, additions, weightUpdates)
+    {
+        std::vector<std::pair<node, edgeweight>> neighbors1, neighbors2;
+
+        // Collects the neighbors of u, for undirected graphs only those with
+        // larger id, sorted by id.
+        auto sortedNeighbors = [&](const Graph &G, node u,
+                                   std::vector<std::pair<node, edgeweight>> &neighbors) {
+            neighbors.clear();
+            if (!G.hasNode(u))
+                return;
+            G.forNeighborsOf(u, [&](node v, edgeweight w) {
+                if (directed || u <= v)
+                    neighbors.emplace_back(v, w);
+            });
+            if (!std::is_sorted(neighbors.begin(), neighbors.end()))
+                std::sort(neighbors.begin(), neighbors.end());
+        };
+
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+            auto &chunkRemovals = edgeRemovals[c];
+            auto &chunkAdditions = edgeAdditions[c];
+            const node end = std::min<node>((c + 1) * chunkSize, upperBound);
+            for (node u = c * chunkSize; u < end; ++u) {
+                sortedNeighbors(*G1, u, neighbors1);
+                sortedNeighbors(*G2, u, neighbors2);
+
+                // Merge both neighborhoods.
+                auto it1 = neighbors1.begin(), it2 = neighbors2.begin();
+                while (it1 != neighbors1.end() || it2 != neighbors2.end()) {
+                    if (it2 == neighbors2.end()
+                        || (it1 != neighbors1.end() && it1->first < it2->first)) {
+                        chunkRemovals.emplace_back(GraphEvent::EDGE_REMOVAL, u, it1->first);
+                        ++removals;
+                        ++it1;
+                    } else if (it1 == neighbors1.end() || it2->first < it1->first) {
+                        chunkAdditions.emplace_back(GraphEvent::EDGE_ADDITION, u, it2->first,
+                                                    it2->second);
+                        ++additions;
+                        ++it2;
+                    } else {
+                        if (it1->second != it2->second) {
+                            chunkAdditions.emplace_back(GraphEvent::EDGE_WEIGHT_UPDATE, u,
+                                                        it2->first, it2->second);
+                            ++weightUpdates;
                         }
+                        ++it1;
+                        ++it2;
                     }
-                });
+                }
+            }
         }
     }
 
+    numEdgeRemovals = removals;
+    numEdgeAdditions = additions;
+    numWeightUpdates = weightUpdates;
     numEdits = numNodeRemovals + numNodeAdditions + numNodeRestorations + numEdgeRemovals + numEdgeAdditions + numWeightUpdates;
 
-    edits.swap(edgeRemovals);
-    edits.reserve(nodeEvents.size() + edgeAdditions.size());
-    edits.insert(edits.end(), nodeEvents.begin(), nodeEvents.end());
-    edits.insert(edits.end(), edgeAdditions.begin(), edgeAdditions.end());
+    auto appendChunk = [&](std::vector<GraphEvent> &chunk) {
+        if (!chunk.empty())
+            editChunks.push_back(std::move(chunk));
+    };
+    for (auto &chunk : edgeRemovals)
+        appendChunk(chunk);
+    appendChunk(nodeEvents);
+    for (auto &chunk : edgeAdditions)
+        appendChunk(chunk);
     hasRun = true;
 }
 
 std::vector< GraphEvent > GraphDifference::getEdits() const {
     assureFinished();
 
+    std::vector<GraphEvent> edits;
+    edits.reserve(numEdits);
+    for (const auto &chunk : editChunks)
+        edits.insert(edits.end(), chunk.begin(), chunk.end());
     return edits;
 }
 
+const std::vector<std::vector<GraphEvent>> &GraphDifference::getEditChunks() const {
+    assureFinished();
+
+    return editChunks;
+}
+
 count GraphDifference::getNumberOfEdits() const {
     assureFinished();
 
@@ -0,0 +1,103 @@
+/*
+ * TemporalGraph.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include <networkit/dynamics/TemporalGraph.hpp>
+
+namespace NetworKit {
+
+TemporalGraph::TemporalGraph(count n, timestamp windowLength, bool weighted, bool directed)
+    : n(n), windowLength(windowLength), weighted(weighted), directed(directed) {
+    if (!windowLength)
+        throw std::runtime_error("Error, the window length must be positive.");
+}
+
+node TemporalGraph::addNode() {
+    events.emplace_back(GraphEvent::NODE_ADDITION);
+    return n++;
+}
+
+void TemporalGraph::addEdge(node u, node v, timestamp t, edgeweight w) {
+    if (u >= n || v >= n)
+        throw std::runtime_error("Error, node " + std::to_string(std::max(u, v))
+                                 + " does not exist.");
+    advanceTo(t);
+
+    sources.push_back(u);
+    targets.push_back(v);
+    if (weighted)
+        weights.push_back(w);
+    times.push_back(t);
+
+    if (++multiplicity[Edge(u, v, !directed)] == 1)
+        events.emplace_back(GraphEvent::EDGE_ADDITION, u, v, weightOf(times.size() - 1));
+    else if (weighted)
+        events.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, w);
+}
+
+void TemporalGraph::advanceTo(timestamp t) {
+    if (t < currentTime)
+        throw std::runtime_error("Error, time " + std::to_string(t) + " is before the current time "
+                                 + std::to_string(currentTime) + ".");
+    currentTime = t;
+
+    for (; first < times.size() && times[first] + windowLength <= currentTime; ++first) {
+        const node u = sources[first], v = targets[first];
+        const auto it = multiplicity.find(Edge(u, v, !directed));
+        if (--it->second == 0) {
+            multiplicity.erase(it);
+            events.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+        } else if (weighted) {
+            events.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, -weights[first]);
+        }
+    }
+
+    // Drop the expired edges once they make up half of the columns, so every edge is moved at
+    // most once on average.
+    if (first >= 1024 && 2 * first >= times.size()) {
+        sources.erase(sources.begin(), sources.begin() + first);
+        targets.erase(targets.begin(), targets.begin() + first);
+        if (weighted)
+            weights.erase(weights.begin(), weights.begin() + first);
+        times.erase(times.begin(), times.begin() + first);
+        first = 0;
+    }
+}
+
+std::vector<GraphEvent> TemporalGraph::popEvents() {
+    std::vector<GraphEvent> result;
+    result.swap(events);
+    return result;
+}
+
+TemporalGraph::Window TemporalGraph::window(timestamp t0, timestamp t1) const {
+    if (t1 < t0)
+        throw std::runtime_error("Error, the window ends before it starts.");
+    const auto begin = std::lower_bound(times.begin() + first, times.end(), t0);
+    const auto end = std::lower_bound(begin, times.end(), t1);
+    return Window(*this, begin - times.begin(), end - times.begin());
+}
+
+Graph TemporalGraph::Window::toGraph() const {
+    Graph result(G->numberOfNodes(), G->isWeighted(), G->isDirected());
+    std::unordered_set<Edge, EdgeHash, std::equal_to<Edge>> seen;
+    forEdges([&](node u, node v, edgeweight w, timestamp) {
+        if (seen.insert(Edge(u, v, !G->isDirected())).second)
+            result.addEdge(u, v, w);
+        else if (G->isWeighted())
+            result.increaseWeight(u, v, w);
+    });
+    return result;
+}
+
+} // namespace NetworKit
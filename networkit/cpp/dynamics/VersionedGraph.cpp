@@ -0,0 +1,323 @@
+/*
+ * VersionedGraph.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <networkit/dynamics/VersionedGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+index find(const std::vector<node> &neighbors, node v) {
+    const auto it = std::find(neighbors.begin(), neighbors.end(), v);
+    return it == neighbors.end() ? none : static_cast<index>(it - neighbors.begin());
+}
+
+template <typename T>
+void erase(std::vector<T> &vec, index i) {
+    vec[i] = vec.back();
+    vec.pop_back();
+}
+
+} // namespace
+
+/**
+ * Builds the next version from the current one. Blocks and adjacency arrays are copied when they
+ * are modified for the first time; the copies belong to the new version only and are modified in
+ * place afterwards.
+ */
+class VersionedGraph::Batch final {
+
+public:
+    Batch(const Version &base, std::shared_ptr<const Adjacency> emptyAdjacency)
+        : next(std::make_shared<Version>(base)), emptyAdjacency(std::move(emptyAdjacency)),
+          writableBlocks(base.blocks.size(), nullptr) {
+        ++next->id;
+    }
+
+    std::shared_ptr<const Version> finish() { return std::move(next); }
+
+    bool hasNode(node u) const { return u < next->upperBound && adjacency(u); }
+
+    node addNode() {
+        const node u = next->upperBound++;
+        if (u / blockSize == next->blocks.size()) {
+            auto fresh = std::make_shared<Block>();
+            writableBlocks.push_back(fresh.get());
+            next->blocks.push_back(std::move(fresh));
+        }
+        block(u / blockSize).nodes.push_back(emptyAdjacency);
+        ++next->numNodes;
+        return u;
+    }
+
+    void removeNode(node u) {
+        checkNode(u);
+        while (!adjacency(u)->out.empty())
+            removeEdge(u, adjacency(u)->out.front());
+        if (next->directed)
+            while (!adjacency(u)->in.empty())
+                removeEdge(adjacency(u)->in.front(), u);
+        block(u / blockSize).nodes[u % blockSize] = nullptr;
+        writableNodes.erase(u);
+        --next->numNodes;
+    }
+
+    void restoreNode(node u) {
+        if (u >= next->upperBound || adjacency(u))
+            throw std::runtime_error("node " + std::to_string(u) + " cannot be restored");
+        block(u / blockSize).nodes[u % blockSize] = emptyAdjacency;
+        ++next->numNodes;
+    }
+
+    void addEdge(node u, node v, edgeweight w) {
+        checkNode(u);
+        checkNode(v);
+        Adjacency &adjU = writable(u);
+        adjU.out.push_back(v);
+        if (next->weighted)
+            adjU.outWeights.push_back(w);
+        if (next->directed) {
+            Adjacency &adjV = writable(v);
+            adjV.in.push_back(u);
+            if (next->weighted)
+                adjV.inWeights.push_back(w);
+        } else if (u != v) {
+            Adjacency &adjV = writable(v);
+            adjV.out.push_back(u);
+            if (next->weighted)
+                adjV.outWeights.push_back(w);
+        }
+        ++next->numEdges;
+    }
+
+    void removeEdge(node u, node v) {
+        checkNode(u);
+        checkNode(v);
+        const index vi = find(adjacency(u)->out, v);
+        if (vi == none) {
+            std::stringstream strm;
+            strm << "edge (" << u << "," << v << ") does not exist";
+            throw std::runtime_error(strm.str());
+        }
+        Adjacency &adjU = writable(u);
+        erase(adjU.out, vi);
+        if (next->weighted)
+            erase(adjU.outWeights, vi);
+        if (next->directed) {
+            Adjacency &adjV = writable(v);
+            const index ui = find(adjV.in, u);
+            erase(adjV.in, ui);
+            if (next->weighted)
+                erase(adjV.inWeights, ui);
+        } else if (u != v) {
+            Adjacency &adjV = writable(v);
+            const index ui = find(adjV.out, u);
+            erase(adjV.out, ui);
+            if (next->weighted)
+                erase(adjV.outWeights, ui);
+        }
+        --next->numEdges;
+    }
+
+    edgeweight weight(node u, node v) const {
+        checkNode(u);
+        const index vi = find(adjacency(u)->out, v);
+        if (vi == none)
+            return nullWeight;
+        return next->weighted ? adjacency(u)->outWeights[vi] : defaultEdgeWeight;
+    }
+
+    void setWeight(node u, node v, edgeweight w) {
+        if (!next->weighted)
+            throw std::runtime_error("Cannot set edge weight in unweighted graph.");
+        checkNode(u);
+        checkNode(v);
+        const index vi = find(adjacency(u)->out, v);
+        if (vi == none) {
+            addEdge(u, v, w);
+            return;
+        }
+        writable(u).outWeights[vi] = w;
+        if (next->directed) {
+            Adjacency &adjV = writable(v);
+            adjV.inWeights[find(adjV.in, u)] = w;
+        } else if (u != v) {
+            Adjacency &adjV = writable(v);
+            adjV.outWeights[find(adjV.out, u)] = w;
+        }
+    }
+
+private:
+    std::shared_ptr<Version> next;
+    std::shared_ptr<const Adjacency> emptyAdjacency;
+    // Blocks and adjacency arrays that have already been copied for this version.
+    std::vector<Block *> writableBlocks;
+    std::unordered_map<node, Adjacency *> writableNodes;
+
+    const Adjacency *adjacency(node u) const {
+        return next->blocks[u / blockSize]->nodes[u % blockSize].get();
+    }
+
+    void checkNode(node u) const {
+        if (!hasNode(u))
+            throw std::runtime_error("node " + std::to_string(u) + " does not exist");
+    }
+
+    Block &block(index b) {
+        if (!writableBlocks[b]) {
+            auto copy = std::make_shared<Block>(*next->blocks[b]);
+            writableBlocks[b] = copy.get();
+            next->blocks[b] = std::move(copy);
+        }
+        return *writableBlocks[b];
+    }
+
+    Adjacency &writable(node u) {
+        const auto it = writableNodes.find(u);
+        if (it != writableNodes.end())
+            return *it->second;
+        auto copy = std::make_shared<Adjacency>(*adjacency(u));
+        Adjacency *result = copy.get();
+        writableNodes[u] = result;
+        block(u / blockSize).nodes[u % blockSize] = std::move(copy);
+        return *result;
+    }
+};
+
+constexpr count VersionedGraph::blockSize;
+
+VersionedGraph::VersionedGraph(count n, bool weighted, bool directed)
+    : emptyAdjacency(std::make_shared<const Adjacency>()) {
+    auto initial = std::make_shared<Version>();
+    initial->weighted = weighted;
+    initial->directed = directed;
+    initial->numNodes = n;
+    initial->upperBound = n;
+    for (node first = 0; first < n; first += blockSize) {
+        auto block = std::make_shared<Block>();
+        block->nodes.assign(std::min(blockSize, n - first), emptyAdjacency);
+        initial->blocks.push_back(std::move(block));
+    }
+    current = std::move(initial);
+}
+
+VersionedGraph::VersionedGraph(const Graph &G)
+    : VersionedGraph(G.upperNodeIdBound(), G.isWeighted(), G.isDirected()) {
+    auto initial = std::make_shared<Version>(*current);
+    initial->numNodes = G.numberOfNodes();
+    initial->numEdges = G.numberOfEdges();
+    std::vector<Block *> blocks;
+    for (auto &block : initial->blocks) {
+        auto copy = std::make_shared<Block>(*block);
+        blocks.push_back(copy.get());
+        block = std::move(copy);
+    }
+
+    // Adjacency arrays of nodes without edges stay shared.
+    G.parallelForNodes([&](node u) {
+        if (G.degree(u) == 0 && G.degreeIn(u) == 0)
+            return;
+        auto adj = std::make_shared<Adjacency>();
+        G.forNeighborsOf(u, [&](node v, edgeweight w) {
+            adj->out.push_back(v);
+            if (G.isWeighted())
+                adj->outWeights.push_back(w);
+        });
+        if (G.isDirected())
+            G.forInNeighborsOf(u, [&](node v, edgeweight w) {
+                adj->in.push_back(v);
+                if (G.isWeighted())
+                    adj->inWeights.push_back(w);
+            });
+        blocks[u / blockSize]->nodes[u % blockSize] = std::move(adj);
+    });
+    for (node u = 0; u < G.upperNodeIdBound(); ++u)
+        if (!G.hasNode(u))
+            blocks[u / blockSize]->nodes[u % blockSize] = nullptr;
+    current = std::move(initial);
+}
+
+void VersionedGraph::update(const std::vector<GraphEvent> &events) {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    Batch batch(*current, emptyAdjacency);
+    for (const GraphEvent &ev : events) {
+        switch (ev.type) {
+        case GraphEvent::NODE_ADDITION:
+            batch.addNode();
+            break;
+        case GraphEvent::NODE_REMOVAL:
+            batch.removeNode(ev.u);
+            break;
+        case GraphEvent::NODE_RESTORATION:
+            batch.restoreNode(ev.u);
+            break;
+        case GraphEvent::EDGE_ADDITION:
+            batch.addEdge(ev.u, ev.v, ev.w);
+            break;
+        case GraphEvent::EDGE_REMOVAL:
+            batch.removeEdge(ev.u, ev.v);
+            break;
+        case GraphEvent::EDGE_WEIGHT_UPDATE:
+            batch.setWeight(ev.u, ev.v, ev.w);
+            break;
+        case GraphEvent::EDGE_WEIGHT_INCREMENT:
+            batch.setWeight(ev.u, ev.v, batch.weight(ev.u, ev.v) + ev.w);
+            break;
+        case GraphEvent::TIME_STEP:
+            break;
+        default:
+            throw std::runtime_error("unknown event type");
+        }
+    }
+    std::atomic_store(&current, batch.finish());
+}
+
+bool VersionedGraph::Snapshot::hasEdge(node u, node v) const {
+    return hasNode(u) && hasNode(v) && find(adjacency(u)->out, v) != none;
+}
+
+edgeweight VersionedGraph::Snapshot::weight(node u, node v) const {
+    if (!hasNode(u))
+        return nullWeight;
+    const Adjacency &adj = *adjacency(u);
+    const index vi = find(adj.out, v);
+    if (vi == none)
+        return nullWeight;
+    return data->weighted ? adj.outWeights[vi] : defaultEdgeWeight;
+}
+
+Graph VersionedGraph::Snapshot::toGraph() const {
+    Graph G(upperNodeIdBound(), isWeighted(), isDirected());
+    for (node u = 0; u < upperNodeIdBound(); ++u)
+        if (!hasNode(u))
+            G.removeNode(u);
+
+    count selfLoops = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : selfLoops)
+    for (omp_index i = 0; i < static_cast<omp_index>(upperNodeIdBound()); ++i) {
+        const node u = static_cast<node>(i);
+        if (!hasNode(u))
+            continue;
+        forNeighborsOf(u, [&](node v, edgeweight w) {
+            G.addPartialOutEdge(unsafe, u, v, w);
+            selfLoops += (u == v);
+        });
+        if (isDirected())
+            forInNeighborsOf(u, [&](node v, edgeweight w) { G.addPartialInEdge(unsafe, u, v, w); });
+    }
+    G.setEdgeCount(unsafe, numberOfEdges());
+    G.setNumberOfSelfLoops(unsafe, selfLoops);
+    return G;
+}
+
+} // namespace NetworKit
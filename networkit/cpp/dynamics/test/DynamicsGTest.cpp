@@ -12,6 +12,14 @@
 #include <networkit/dynamics/GraphEvent.hpp>
 #include <networkit/dynamics/GraphUpdater.hpp>
 #include <networkit/dynamics/GraphDifference.hpp>
+#include <networkit/dynamics/TemporalGraph.hpp>
+#include <networkit/dynamics/VersionedGraph.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/graph/GraphTools.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <omp.h>
 
 namespace NetworKit {
 
@@ -186,4 +194,292 @@ TEST_F(DynamicsGTest, testGraphDifferenceDirectedWeighted) {
     }
 }
 
+TEST_F(DynamicsGTest, testGraphDifferenceParallel) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        // Several chunks of nodes; GraphDifference does not support multi-edges.
+        Graph G1(20000, true, directed);
+        for (count i = 0; i < 60000; ++i) {
+            const node u = GraphTools::randomNode(G1);
+            const node v = GraphTools::randomNode(G1);
+            if (!G1.hasEdge(u, v))
+                G1.addEdge(u, v, Aux::Random::integer(3));
+        }
+        for (count i = 0; i < 100; ++i) {
+            const node u = GraphTools::randomNode(G1);
+            G1.removeNode(u);
+        }
+
+        Graph G2 = G1;
+        std::vector<std::pair<node, node>> edges;
+        G1.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+        for (const auto &e : edges) {
+            const double r = Aux::Random::real();
+            if (r < 0.1)
+                G2.removeEdge(e.first, e.second);
+            else if (r < 0.2)
+                G2.setWeight(e.first, e.second, G2.weight(e.first, e.second) + 1);
+        }
+        for (count i = 0; i < 100; ++i) {
+            const node u = GraphTools::randomNode(G2);
+            G2.removeNode(u);
+        }
+        for (node u = 0; u < G2.upperNodeIdBound(); ++u) {
+            if (!G2.hasNode(u)) {
+                G2.restoreNode(u);
+                break;
+            }
+        }
+        for (count i = 0; i < 10; ++i)
+            G2.addNode();
+        for (count i = 0; i < 6000; ++i) {
+            const node u = GraphTools::randomNode(G2);
+            const node v = GraphTools::randomNode(G2);
+            if (!G2.hasEdge(u, v))
+                G2.addEdge(u, v, Aux::Random::integer(3));
+        }
+
+        GraphDifference diff(G1, G2);
+        diff.run();
+        const auto edits = diff.getEdits();
+
+        // The edits do not depend on the number of threads.
+        const int threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        GraphDifference sequentialDiff(G1, G2);
+        sequentialDiff.run();
+        omp_set_num_threads(threads);
+        const auto sequentialEdits = sequentialDiff.getEdits();
+        ASSERT_EQ(edits.size(), sequentialEdits.size());
+        for (index i = 0; i < edits.size(); ++i)
+            EXPECT_TRUE(GraphEvent::equal(edits[i], sequentialEdits[i]));
+
+        count chunkEvents = 0;
+        for (const auto &chunk : diff.getEditChunks())
+            chunkEvents += chunk.size();
+        EXPECT_EQ(chunkEvents, edits.size());
+
+        Graph H = G1;
+        GraphUpdater(H).update(edits);
+        expect_graph_equals(H, G2);
+        G2.forEdges([&](node u, node v, edgeweight w) { EXPECT_EQ(H.weight(u, v), w); });
+    }
+}
+
+TEST_F(DynamicsGTest, testVersionedGraph) {
+    Aux::Random::setSeed(42, false);
+    for (bool directed : {false, true}) {
+        Graph G(100, true, directed);
+        // GraphDifference does not support multi-edges.
+        for (count i = 0; i < 300; ++i) {
+            const node u = GraphTools::randomNode(G);
+            const node v = GraphTools::randomNode(G);
+            if (!G.hasEdge(u, v))
+                G.addEdge(u, v, Aux::Random::real());
+        }
+        VersionedGraph VG(G);
+        GraphUpdater updater(G);
+
+        std::vector<VersionedGraph::Snapshot> snapshots{VG.snapshot()};
+        std::vector<Graph> expected{G};
+        for (count b = 0; b < 20; ++b) {
+            std::vector<GraphEvent> batch;
+            std::vector<node> removed;
+            for (count i = 0; i < 50; ++i) {
+                const node u = GraphTools::randomNode(G);
+                const node v = GraphTools::randomNode(G);
+                GraphEvent event;
+                switch (Aux::Random::integer(5)) {
+                case 0:
+                    if (G.hasEdge(u, v))
+                        continue;
+                    event = GraphEvent(GraphEvent::EDGE_ADDITION, u, v, Aux::Random::real());
+                    break;
+                case 1:
+                    if (G.degree(u) == 0)
+                        continue;
+                    event = GraphEvent(GraphEvent::EDGE_REMOVAL, u, GraphTools::randomNeighbor(G, u));
+                    break;
+                case 2:
+                    event = GraphEvent(GraphEvent::EDGE_WEIGHT_UPDATE, u, v, Aux::Random::real());
+                    break;
+                case 3:
+                    if (!G.hasEdge(u, v))
+                        continue;
+                    event = GraphEvent(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, Aux::Random::real());
+                    break;
+                case 4:
+                    if (G.numberOfNodes() < 50)
+                        continue;
+                    event = GraphEvent(GraphEvent::NODE_REMOVAL, u);
+                    removed.push_back(u);
+                    break;
+                default:
+                    if (removed.empty())
+                        continue;
+                    event = GraphEvent(GraphEvent::NODE_RESTORATION, removed.back());
+                    removed.pop_back();
+                }
+                batch.push_back(event);
+                updater.update({event});
+            }
+            batch.emplace_back(GraphEvent::NODE_ADDITION);
+            updater.update({batch.back()});
+
+            VG.update(batch);
+            EXPECT_EQ(VG.currentVersion(), b + 1);
+            snapshots.push_back(VG.snapshot());
+            expected.push_back(G);
+        }
+
+        // Old snapshots are not changed by later updates.
+        for (index i = 0; i < snapshots.size(); ++i) {
+            const auto &snapshot = snapshots[i];
+            EXPECT_EQ(snapshot.version(), i);
+            Graph H = snapshot.toGraph();
+            expect_graph_equals(H, expected[i]);
+            expected[i].forEdges([&](node u, node v, edgeweight w) {
+                EXPECT_EQ(snapshot.weight(u, v), w);
+            });
+            expected[i].forNodes([&](node u) {
+                EXPECT_EQ(snapshot.degree(u), expected[i].degree(u));
+                EXPECT_EQ(snapshot.degreeIn(u), expected[i].degreeIn(u));
+            });
+        }
+    }
+}
+
+TEST_F(DynamicsGTest, testVersionedGraphInvalidBatch) {
+    VersionedGraph VG(3, false, false);
+    VG.update({GraphEvent(GraphEvent::EDGE_ADDITION, 0, 1)});
+    EXPECT_THROW(VG.update({GraphEvent(GraphEvent::EDGE_ADDITION, 1, 2),
+                            GraphEvent(GraphEvent::EDGE_REMOVAL, 0, 2)}),
+                 std::runtime_error);
+    EXPECT_THROW(VG.update({GraphEvent(GraphEvent::EDGE_WEIGHT_UPDATE, 0, 1, 2.0)}),
+                 std::runtime_error);
+
+    // Failed batches are not published.
+    const auto snapshot = VG.snapshot();
+    EXPECT_EQ(snapshot.version(), 1);
+    EXPECT_EQ(snapshot.numberOfEdges(), 1);
+    EXPECT_TRUE(snapshot.hasEdge(1, 0));
+    EXPECT_FALSE(snapshot.hasEdge(1, 2));
+}
+
+TEST_F(DynamicsGTest, testVersionedGraphConcurrentReaders) {
+    const count n = 1000, numBatches = 200;
+    VersionedGraph VG(n, false, false);
+    std::atomic<bool> done{false};
+    std::atomic<count> inconsistent{0}, reads{0};
+
+#pragma omp parallel num_threads(4)
+    {
+        if (omp_get_thread_num() == 0) {
+            // Every batch adds 15 edges and removes 5, so version i has 10 * i edges.
+            std::vector<Edge> edges;
+            for (count b = 0; b < numBatches; ++b) {
+                std::vector<GraphEvent> batch;
+                for (count i = 0; i < 15; ++i) {
+                    const node u = Aux::Random::integer(n - 1);
+                    const node v = (u + 1 + Aux::Random::integer(n - 2)) % n;
+                    edges.emplace_back(u, v);
+                    batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+                }
+                for (count i = 0; i < 5; ++i) {
+                    std::swap(edges[Aux::Random::integer(edges.size() - 1)], edges.back());
+                    batch.emplace_back(GraphEvent::EDGE_REMOVAL, edges.back().u, edges.back().v);
+                    edges.pop_back();
+                }
+                VG.update(batch);
+            }
+            done = true;
+        } else {
+            while (!done) {
+                const auto snapshot = VG.snapshot();
+                count degrees = 0;
+                snapshot.forNodes([&](node u) { degrees += snapshot.degree(u); });
+                if (snapshot.numberOfEdges() != 10 * snapshot.version()
+                    || degrees != 2 * snapshot.numberOfEdges())
+                    ++inconsistent;
+                ++reads;
+            }
+        }
+    }
+
+    EXPECT_EQ(inconsistent, 0);
+    EXPECT_GT(reads, 0);
+    EXPECT_EQ(VG.currentVersion(), numBatches);
+    EXPECT_EQ(VG.snapshot().numberOfEdges(), 10 * numBatches);
+}
+
+TEST_F(DynamicsGTest, testTemporalGraph) {
+    Aux::Random::setSeed(42, false);
+    for (bool weighted : {false, true}) {
+        for (bool directed : {false, true}) {
+            const TemporalGraph::timestamp windowLength = 50;
+            TemporalGraph TG(30, windowLength, weighted, directed);
+            Graph G(30, weighted, directed);
+            GraphUpdater updater(G);
+
+            struct TimedEdge {
+                node u, v;
+                TemporalGraph::timestamp t;
+            };
+            std::vector<TimedEdge> added;
+
+            TemporalGraph::timestamp t = 0;
+            for (count i = 0; i < 5000; ++i) {
+                t += Aux::Random::integer(2);
+                // Few nodes, so that edges between the same nodes overlap in the window.
+                const node u = Aux::Random::integer(TG.numberOfNodes() - 1);
+                const node v = Aux::Random::integer(TG.numberOfNodes() - 1);
+                TG.addEdge(u, v, t, Aux::Random::integer(1, 3));
+                added.push_back({u, v, t});
+                if (i % 100 == 0)
+                    TG.advanceTo(t + Aux::Random::integer(windowLength));
+                if (i % 500 == 0)
+                    TG.addNode();
+                t = TG.now();
+
+                if (i % 97 != 0)
+                    continue;
+                updater.update(TG.popEvents());
+                const Graph expected = TG.currentWindow().toGraph();
+                ASSERT_EQ(G.numberOfNodes(), expected.numberOfNodes());
+                ASSERT_EQ(G.numberOfEdges(), expected.numberOfEdges());
+                expected.forEdges([&](node x, node y, edgeweight w) {
+                    ASSERT_TRUE(G.hasEdge(x, y));
+                    EXPECT_DOUBLE_EQ(G.weight(x, y), w);
+                });
+
+                // Windows contain exactly the edges of their time range that have not expired.
+                const TemporalGraph::timestamp t0 = Aux::Random::integer(t);
+                const TemporalGraph::timestamp t1 = t0 + Aux::Random::integer(windowLength);
+                const auto window = TG.window(t0, t1);
+                const count numExpected =
+                    std::count_if(added.begin(), added.end(), [&](const TimedEdge &e) {
+                        return t0 <= e.t && e.t < t1 && e.t + windowLength > t;
+                    });
+                EXPECT_EQ(window.numberOfEdges(), numExpected);
+                window.forEdges([&](node, node, edgeweight, TemporalGraph::timestamp time) {
+                    EXPECT_TRUE(t0 <= time && time < t1 && time + windowLength > t);
+                });
+                std::atomic<count> parallelEdges{0};
+                window.parallelForEdges([&](node, node, edgeweight, TemporalGraph::timestamp) {
+                    ++parallelEdges;
+                });
+                EXPECT_EQ(parallelEdges, numExpected);
+            }
+
+            // All edges expire eventually.
+            TG.advanceTo(t + windowLength);
+            updater.update(TG.popEvents());
+            EXPECT_EQ(TG.numberOfEdges(), 0);
+            EXPECT_EQ(G.numberOfEdges(), 0);
+            EXPECT_THROW(TG.addEdge(0, 1, t), std::runtime_error);
+            EXPECT_THROW(TG.addEdge(0, TG.numberOfNodes(), t + windowLength), std::runtime_error);
+        }
+    }
+}
+
 } /* namespace NetworKit */
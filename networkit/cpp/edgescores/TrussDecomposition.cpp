@@ -0,0 +1,217 @@
+/*
+ * TrussDecomposition.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <omp.h>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/SortedIntersection.hpp>
+#include <networkit/edgescores/TriangleEdgeScore.hpp>
+#include <networkit/edgescores/TrussDecomposition.hpp>
+#include <networkit/graph/SortedAdjacency.hpp>
+
+namespace NetworKit {
+
+TrussDecomposition::TrussDecomposition(const Graph &G) : EdgeScore<count>(G), maxTruss(0) {
+    if (G.isDirected())
+        throw std::runtime_error("TrussDecomposition: the graph must be undirected.");
+    if (G.numberOfSelfLoops())
+        throw std::runtime_error("TrussDecomposition does not support graphs with self-loops. "
+                                 "Call Graph.removeSelfLoops() first.");
+}
+
+void TrussDecomposition::run() {
+    if (!G->hasEdgeIds()) {
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+    }
+
+    const count omega = G->upperEdgeIdBound();
+
+    // Initial support of each edge: the number of triangles it is part of.
+    TriangleEdgeScore triangles(*G);
+    triangles.run();
+    std::unique_ptr<std::atomic<count>[]> support(new std::atomic<count>[omega] {});
+    {
+        const auto triangleCounts = triangles.scores();
+#pragma omp parallel for
+        for (omp_index eid = 0; eid < static_cast<omp_index>(omega); ++eid)
+            support[eid].store(triangleCounts[eid], std::memory_order_relaxed);
+    }
+
+    // Sorted adjacency arrays together with the ids of the corresponding edges.
+    const SortedAdjacency adjacency(*G, true);
+    std::vector<node> edgeSource(omega, none), edgeTarget(omega, none);
+    G->parallelForEdges([&](node u, node v, edgeid eid) {
+        edgeSource[eid] = u;
+        edgeTarget[eid] = v;
+    });
+
+    // Ids that do not belong to any edge are marked as processed from the start.
+    std::vector<unsigned char> processed(omega, 1);
+    std::vector<unsigned char> inCurrent(omega, 0);
+    G->parallelForEdges([&](node, node, edgeid eid) { processed[eid] = 0; });
+
+    scoreData.assign(omega, 0);
+    edgeOrder.clear();
+    edgeOrder.reserve(G->numberOfEdges());
+
+    const int maxThreads = omp_get_max_threads();
+    std::vector<std::vector<edgeid>> localBuckets(maxThreads);
+
+    std::vector<edgeid> curr, next;
+    count remaining = G->numberOfEdges();
+    count level = 0;
+
+    // Decreases the support of edge eid if it is still above the current level. Exactly one
+    // thread observes the transition to the current level and enqueues the edge.
+    auto decreaseSupport = [&](edgeid eid, std::vector<edgeid> &bucket) {
+        if (support[eid].load(std::memory_order_relaxed) <= level)
+            return;
+        const count old = support[eid].fetch_sub(1, std::memory_order_relaxed);
+        if (old == level + 1)
+            bucket.push_back(eid);
+        else if (old <= level)
+            support[eid].fetch_add(1, std::memory_order_relaxed);
+    };
+
+    // Collects all unprocessed edges whose support equals the current level. Returns the
+    // smallest support larger than the level among the remaining edges.
+    auto scan = [&]() -> count {
+        std::vector<count> localNextLevel(maxThreads, none);
+#pragma omp parallel
+        {
+            const auto tid = omp_get_thread_num();
+            auto &bucket = localBuckets[tid];
+#pragma omp for schedule(static) nowait
+            for (omp_index eid = 0; eid < static_cast<omp_index>(omega); ++eid) {
+                if (processed[eid])
+                    continue;
+                const count s = support[eid].load(std::memory_order_relaxed);
+                if (s == level)
+                    bucket.push_back(eid);
+                else if (s < localNextLevel[tid])
+                    localNextLevel[tid] = s;
+            }
+        }
+
+        curr.clear();
+        for (auto &bucket : localBuckets) {
+            curr.insert(curr.end(), bucket.begin(), bucket.end());
+            bucket.clear();
+        }
+        return *std::min_element(localNextLevel.begin(), localNextLevel.end());
+    };
+
+    while (remaining > 0) {
+        const count nextLevel = scan();
+        if (curr.empty()) {
+            level = nextLevel;
+            continue;
+        }
+
+        while (!curr.empty()) {
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(curr.size()); ++i)
+                inCurrent[curr[i]] = 1;
+
+#pragma omp parallel
+            {
+                auto &bucket = localBuckets[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64) nowait
+                for (omp_index i = 0; i < static_cast<omp_index>(curr.size()); ++i) {
+                    const edgeid e1 = curr[i];
+                    const node u = edgeSource[e1], v = edgeTarget[e1];
+
+                    // Intersect the sorted neighborhoods of u and v to enumerate the
+                    // triangles (u, v, w) with edges e2 = {u, w} and e3 = {v, w}.
+                    const edgeid *idsU = adjacency.edgeIds(u), *idsV = adjacency.edgeIds(v);
+                    Aux::SortedIntersection::forIntersection(
+                        adjacency.neighbors(u), adjacency.degree(u), adjacency.neighbors(v),
+                        adjacency.degree(v), [&](index iu, index iv) {
+                            const edgeid e2 = idsU[iu], e3 = idsV[iv];
+                            if (processed[e2] || processed[e3])
+                                return;
+
+                            // Triangles with several edges in the current set must only be
+                            // accounted for once; the edge with the smallest id does it.
+                            if (inCurrent[e2] && inCurrent[e3])
+                                return;
+                            if (inCurrent[e2]) {
+                                if (e1 < e2)
+                                    decreaseSupport(e3, bucket);
+                            } else if (inCurrent[e3]) {
+                                if (e1 < e3)
+                                    decreaseSupport(e2, bucket);
+                            } else {
+                                decreaseSupport(e2, bucket);
+                                decreaseSupport(e3, bucket);
+                            }
+                        });
+                }
+            }
+
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(curr.size()); ++i) {
+                const edgeid eid = curr[i];
+                processed[eid] = 1;
+                inCurrent[eid] = 0;
+                scoreData[eid] = level + 2;
+            }
+
+            edgeOrder.insert(edgeOrder.end(), curr.begin(), curr.end());
+            remaining -= curr.size();
+
+            next.clear();
+            for (auto &bucket : localBuckets) {
+                next.insert(next.end(), bucket.begin(), bucket.end());
+                bucket.clear();
+            }
+            std::swap(curr, next);
+        }
+
+        ++level;
+    }
+
+    maxTruss = edgeOrder.empty() ? 0 : scoreData[edgeOrder.back()];
+
+    trussOffsets.assign(maxTruss + 2, 0);
+    {
+        index pos = 0;
+        for (count k = 0; k <= maxTruss + 1; ++k) {
+            while (pos < edgeOrder.size() && scoreData[edgeOrder[pos]] < k)
+                ++pos;
+            trussOffsets[k] = pos;
+        }
+    }
+
+    INFO("Maximum trussness: ", maxTruss);
+    hasRun = true;
+}
+
+count TrussDecomposition::maxTrussness() const {
+    assureFinished();
+    return maxTruss;
+}
+
+const std::vector<edgeid> &TrussDecomposition::getEdgeOrder() const {
+    assureFinished();
+    return edgeOrder;
+}
+
+const std::vector<index> &TrussDecomposition::getTrussOffsets() const {
+    assureFinished();
+    return trussOffsets;
+}
+
+std::vector<edgeid> TrussDecomposition::getEdgesOfTruss(count k) const {
+    assureFinished();
+    const index begin = trussOffsets[std::min(k, maxTruss + 1)];
+    return std::vector<edgeid>(edgeOrder.begin() + begin, edgeOrder.end());
+}
+
+} /* namespace NetworKit */
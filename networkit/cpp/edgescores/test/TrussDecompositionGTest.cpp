@@ -0,0 +1,103 @@
+/*
+ * TrussDecompositionGTest.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/edgescores/TrussDecomposition.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+
+namespace NetworKit {
+
+class TrussDecompositionGTest : public testing::Test {};
+
+TEST_F(TrussDecompositionGTest, testCliqueWithPendantEdge) {
+    // 4-clique on the nodes 0-3, a triangle 3-4-5 and a pendant edge 5-6.
+    Graph G(7);
+    for (node u = 0; u < 4; ++u)
+        for (node v = u + 1; v < 4; ++v)
+            G.addEdge(u, v);
+    G.addEdge(3, 4);
+    G.addEdge(3, 5);
+    G.addEdge(4, 5);
+    G.addEdge(5, 6);
+    G.indexEdges();
+
+    TrussDecomposition truss(G);
+    truss.run();
+    const auto scores = truss.scores();
+
+    for (node u = 0; u < 4; ++u)
+        for (node v = u + 1; v < 4; ++v)
+            EXPECT_EQ(scores[G.edgeId(u, v)], 4);
+    EXPECT_EQ(scores[G.edgeId(3, 4)], 3);
+    EXPECT_EQ(scores[G.edgeId(3, 5)], 3);
+    EXPECT_EQ(scores[G.edgeId(4, 5)], 3);
+    EXPECT_EQ(scores[G.edgeId(5, 6)], 2);
+
+    EXPECT_EQ(truss.maxTrussness(), 4);
+    EXPECT_EQ(truss.getEdgesOfTruss(4).size(), 6);
+    EXPECT_EQ(truss.getEdgesOfTruss(3).size(), 9);
+    EXPECT_EQ(truss.getEdgesOfTruss(2).size(), 10);
+    EXPECT_TRUE(truss.getEdgesOfTruss(5).empty());
+
+    const auto &order = truss.getEdgeOrder();
+    ASSERT_EQ(order.size(), G.numberOfEdges());
+    for (index i = 1; i < order.size(); ++i)
+        EXPECT_LE(scores[order[i - 1]], scores[order[i]]);
+}
+
+TEST_F(TrussDecompositionGTest, testRandomGraphsAgainstSequentialPeeling) {
+    Aux::Random::setSeed(42, false);
+
+    for (int iter = 0; iter < 5; ++iter) {
+        Graph G = ErdosRenyiGenerator(100, 0.15).generate();
+        G.indexEdges();
+
+        TrussDecomposition truss(G);
+        truss.run();
+        const auto scores = truss.scores();
+
+        // Naive peeling: repeatedly remove an edge of minimum support.
+        Graph H(G);
+        std::vector<count> expected(G.upperEdgeIdBound(), 0);
+        count k = 2;
+        while (H.numberOfEdges() > 0) {
+            count minSupport = none;
+            node minU = none, minV = none;
+            H.forEdges([&](node u, node v) {
+                count support = 0;
+                H.forNeighborsOf(u, [&](node w) {
+                    if (w != v && H.hasEdge(v, w))
+                        ++support;
+                });
+                if (support < minSupport) {
+                    minSupport = support;
+                    minU = u;
+                    minV = v;
+                }
+            });
+            k = std::max(k, minSupport + 2);
+            expected[G.edgeId(minU, minV)] = k;
+            H.removeEdge(minU, minV);
+        }
+
+        G.forEdges([&](node, node, edgeid eid) { EXPECT_EQ(scores[eid], expected[eid]); });
+        EXPECT_EQ(truss.maxTrussness(), k);
+    }
+}
+
+TEST_F(TrussDecompositionGTest, testEmptyGraph) {
+    Graph G(10);
+    G.indexEdges();
+
+    TrussDecomposition truss(G);
+    truss.run();
+    EXPECT_EQ(truss.maxTrussness(), 0);
+    EXPECT_TRUE(truss.getEdgeOrder().empty());
+}
+
+} // namespace NetworKit
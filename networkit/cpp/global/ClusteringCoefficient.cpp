@@ -13,9 +13,67 @@
 #include <networkit/centrality/LocalClusteringCoefficient.hpp>
 #include <networkit/global/ClusteringCoefficient.hpp>
 #include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/OrientedGraph.hpp>
 
 namespace NetworKit {
 
+namespace {
+
+// Closed wedges over the out-neighborhoods; OrientedGraph only lists triangles of undirected graphs.
+double exactGlobalDirected(const Graph &G) {
+    count z = G.upperNodeIdBound();
+    std::vector<count> triangles(z); // triangles including node u (every triangle is counted six times)
+
+    std::vector<std::vector<bool> > nodeMarker(omp_get_max_threads());
+    for (auto &nm : nodeMarker) {
+        nm.resize(z, false);
+    }
+
+    G.balancedParallelForNodes([&](node u){
+
+        size_t tid = omp_get_thread_num();
+        count tr = 0;
+
+        if (G.degree(u) > 1) {
+            G.forEdgesOf(u, [&](node, node v) {
+                nodeMarker[tid][v] = true;
+            });
+
+            G.forEdgesOf(u, [&](node, node v) {
+                G.forEdgesOf(v, [&](node, node w) {
+                    if (nodeMarker[tid][w]) {
+                        tr += 1;
+                    }
+                });
+            });
+
+            G.forEdgesOf(u, [&](node, node v) {
+                nodeMarker[tid][v] = false;
+            });
+        }
+
+        triangles[u] = tr;
+    });
+
+  double denominator = G.parallelSumForNodes([&](node u){
+        return G.degree(u) * (G.degree(u) - 1);
+    });
+
+    double cc = G.parallelSumForNodes([&](node u){
+        return triangles[u];
+    });
+
+    if (denominator == 0) {
+        return 0; // no triangle exists
+    }
+
+    cc /= denominator;
+
+    return cc;
+}
+
+} // namespace
+
 double ClusteringCoefficient::sequentialAvgLocal(const Graph &G) {
     WARN("DEPRECATED: use centrality.LocalClusteringCoefficient and take average");
     std::vector<std::vector<node> > edges(G.upperNodeIdBound());
@@ -167,55 +225,25 @@ double ClusteringCoefficient::approxAvgLocal(Graph& G, const count trials) {
 
 
 double ClusteringCoefficient::exactGlobal(Graph& G) {
-    count z = G.upperNodeIdBound();
-    std::vector<count> triangles(z); // triangles including node u (every triangle is counted six times)
-
-    std::vector<std::vector<bool> > nodeMarker(omp_get_max_threads());
-    for (auto &nm : nodeMarker) {
-        nm.resize(z, false);
-    }
+    if (G.isDirected())
+        return exactGlobalDirected(G);
 
-    G.balancedParallelForNodes([&](node u){
-
-        size_t tid = omp_get_thread_num();
-        count tr = 0;
-
-        if (G.degree(u) > 1) {
-            G.forEdgesOf(u, [&](node, node v) {
-                nodeMarker[tid][v] = true;
-            });
+    // Every triangle closes six ordered wedges (u, v, w).
+    const double closedWedges = 6.0 * OrientedGraph(G).numberOfTriangles();
 
-            G.forEdgesOf(u, [&](node, node v) {
-                G.forEdgesOf(v, [&](node, node w) {
-                    if (nodeMarker[tid][w]) {
-                        tr += 1;
-                    }
-                });
-            });
-
-            G.forEdgesOf(u, [&](node, node v) {
-                nodeMarker[tid][v] = false;
-            });
-        }
-
-        triangles[u] = tr;
-    });
-
-  double denominator = G.parallelSumForNodes([&](node u){
-        return G.degree(u) * (G.degree(u) - 1);
-    });
-
-    double cc = G.parallelSumForNodes([&](node u){
-        return triangles[u];
+    const bool hasSelfLoops = G.numberOfSelfLoops() > 0;
+    double denominator = G.parallelSumForNodes([&](node u){
+        count d = G.degree(u);
+        if (hasSelfLoops)
+            G.forNeighborsOf(u, [&](node v) { d -= (u == v); });
+        return d * (d - 1);
     });
 
     if (denominator == 0) {
         return 0; // no triangle exists
     }
 
-    cc /= denominator;
-
-    return cc;
+    return closedWedges / denominator;
 }
 
 
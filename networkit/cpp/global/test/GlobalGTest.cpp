@@ -40,6 +40,18 @@ TEST_F(GlobalGTest, testGlobalClusteringCoefficient) {
 
     double ccg = ClusteringCoefficient::exactGlobal(G);
     EXPECT_NEAR(ccg, 18.0 / 34.0, 1e-9);
+
+    // Self-loops are ignored.
+    G.addEdge(1, 1);
+    G.addEdge(5, 5);
+    EXPECT_NEAR(ClusteringCoefficient::exactGlobal(G), 18.0 / 34.0, 1e-9);
+
+    // In directed graphs, the wedges are formed by the out-neighborhoods.
+    Graph directed(3, false, true);
+    directed.addEdge(0, 1);
+    directed.addEdge(0, 2);
+    directed.addEdge(1, 2);
+    EXPECT_NEAR(ClusteringCoefficient::exactGlobal(directed), 0.5, 1e-9);
 }
 
 } /* namespace NetworKit */
@@ -0,0 +1,162 @@
+/*
+ * OrientedGraph.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/graph/OrientedGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Ranks the nodes by increasing degree, ties are broken by id.
+std::vector<index> degreeRanks(const Graph &G) {
+    std::vector<node> nodes;
+    nodes.reserve(G.numberOfNodes());
+    G.forNodes([&](node u) { nodes.push_back(u); });
+    Aux::Parallel::sort(nodes.begin(), nodes.end(), [&](node u, node v) {
+        const count degU = G.degree(u), degV = G.degree(v);
+        return degU < degV || (degU == degV && u < v);
+    });
+
+    std::vector<index> ranks(G.upperNodeIdBound(), none);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(nodes.size()); ++i)
+        ranks[nodes[i]] = static_cast<index>(i);
+    return ranks;
+}
+
+// Ranks the nodes in the order in which they are removed by the bucket-based core decomposition
+// of Batagelj and Zaversnik, i.e., by repeatedly removing a node of minimum remaining degree.
+std::vector<index> degeneracyRanks(const Graph &G) {
+    const count z = G.upperNodeIdBound();
+    std::vector<count> degree(z, 0);
+    count maxDegree = 0;
+    G.forNodes([&](node u) {
+        degree[u] = G.degree(u);
+        maxDegree = std::max(maxDegree, degree[u]);
+    });
+
+    // bucketStart[d] is the position of the first node with remaining degree d in sorted.
+    std::vector<index> bucketStart(maxDegree + 2, 0);
+    G.forNodes([&](node u) { ++bucketStart[degree[u] + 1]; });
+    for (index d = 0; d <= maxDegree; ++d)
+        bucketStart[d + 1] += bucketStart[d];
+
+    std::vector<node> sorted(G.numberOfNodes());
+    std::vector<index> position(z, none);
+    {
+        std::vector<index> next(bucketStart.begin(), bucketStart.end() - 1);
+        G.forNodes([&](node u) {
+            position[u] = next[degree[u]]++;
+            sorted[position[u]] = u;
+        });
+    }
+
+    std::vector<index> ranks(z, none);
+    for (index i = 0; i < sorted.size(); ++i) {
+        const node u = sorted[i];
+        ranks[u] = i;
+        G.forNeighborsOf(u, [&](node v) {
+            if (ranks[v] != none || degree[v] <= degree[u])
+                return;
+            // Move v to the front of its bucket and shrink the bucket by one.
+            const count d = degree[v];
+            const index front = bucketStart[d];
+            const node w = sorted[front];
+            if (w != v) {
+                std::swap(sorted[front], sorted[position[v]]);
+                position[w] = position[v];
+                position[v] = front;
+            }
+            ++bucketStart[d];
+            --degree[v];
+        });
+    }
+
+    return ranks;
+}
+
+} // namespace
+
+OrientedGraph::OrientedGraph(const Graph &G, Ordering ordering, bool withEdgeIds) : G(&G) {
+    if (G.isDirected())
+        throw std::runtime_error("OrientedGraph requires an undirected graph");
+
+    ranks = ordering == Ordering::DEGREE ? degreeRanks(G) : degeneracyRanks(G);
+    out = SortedAdjacency(G, [&](node u, node v) { return ranks[u] < ranks[v]; }, withEdgeIds);
+
+    const count z = G.upperNodeIdBound();
+    entrySource.resize(out.numberOfEntries());
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        std::fill_n(entrySource.begin() + out.offset(u), out.degree(u), static_cast<node>(u));
+
+    count maxDeg = 0;
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(max : maxDeg)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        maxDeg = std::max(maxDeg, out.degree(u));
+#else
+    for (node u = 0; u < z; ++u)
+        maxDeg = std::max(maxDeg, out.degree(u));
+#endif
+    maxOutDeg = maxDeg;
+}
+
+count OrientedGraph::numberOfTriangles() const {
+    const count numEntries = out.numberOfEntries();
+    count triangles = 0;
+#pragma omp parallel for schedule(dynamic, 256) reduction(+ : triangles)
+    for (omp_index i = 0; i < static_cast<omp_index>(numEntries); ++i) {
+        const node u = entrySource[i];
+        const node v = out.neighbors(u)[static_cast<index>(i) - out.offset(u)];
+        triangles += Aux::SortedIntersection::intersectionSize(out.neighbors(u), out.degree(u),
+                                                               out.neighbors(v), out.degree(v));
+    }
+    return triangles;
+}
+
+std::vector<count> OrientedGraph::trianglesPerNode() const {
+    const count z = G->upperNodeIdBound();
+    std::unique_ptr<std::atomic<count>[]> triangles(new std::atomic<count>[z] {});
+
+    parallelForTriangles([&](node u, node v, node w) {
+        triangles[u].fetch_add(1, std::memory_order_relaxed);
+        triangles[v].fetch_add(1, std::memory_order_relaxed);
+        triangles[w].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    std::vector<count> result(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        result[u] = triangles[u].load(std::memory_order_relaxed);
+    return result;
+}
+
+std::vector<count> OrientedGraph::trianglesPerEdge() const {
+    const count m = G->upperEdgeIdBound();
+    std::unique_ptr<std::atomic<count>[]> triangles(new std::atomic<count>[m] {});
+
+    parallelForTrianglesWithEdgeIds([&](node, node, node, edgeid uv, edgeid uw, edgeid vw) {
+        triangles[uv].fetch_add(1, std::memory_order_relaxed);
+        triangles[uw].fetch_add(1, std::memory_order_relaxed);
+        triangles[vw].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    std::vector<count> result(m);
+#pragma omp parallel for
+    for (omp_index e = 0; e < static_cast<omp_index>(m); ++e)
+        result[e] = triangles[e].load(std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,14 @@
+/*
+ * SortedAdjacency.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+#include <networkit/graph/SortedAdjacency.hpp>
+
+namespace NetworKit {
+
+SortedAdjacency::SortedAdjacency(const Graph &G, bool withEdgeIds)
+    : SortedAdjacency(G, [](node, node) { return true; }, withEdgeIds) {}
+
+} // namespace NetworKit
@@ -3,6 +3,7 @@
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/graph/GraphTools.hpp>
 #include <networkit/graph/UnionMaximumSpanningForest.hpp>
+#include <networkit/structures/ConcurrentUnionFind.hpp>
 
 namespace NetworKit {
 
@@ -46,23 +47,25 @@ void UnionMaximumSpanningForest::run() {
 
     handler.assureRunning();
 
-    edgeweight currentAttribute = std::numeric_limits<edgeweight>::max();
-
-    std::vector<std::pair<node, node> > nodesToMerge;
-    UnionFind uf(G->upperNodeIdBound());
-
-    for (weightedEdge e : weightedEdges) {
-        if (e.attribute != currentAttribute) {
-            for (auto candidate : nodesToMerge) {
-                uf.merge(candidate.first, candidate.second);
-            }
-
-            nodesToMerge.clear();
-            currentAttribute = e.attribute;
-        }
-
-
-        if (uf.find(e.u) != uf.find(e.v)) {
+    ConcurrentUnionFind uf(G->upperNodeIdBound());
+    std::vector<unsigned char> selected(weightedEdges.size(), false);
+
+    // An edge is in the union of all maximum spanning forests iff its endpoints are not connected
+    // by heavier edges, so the edges of a group of equal weight are checked independently of each
+    // other and only merged afterwards.
+    for (index begin = 0, end = 0; begin < weightedEdges.size(); begin = end) {
+        while (end < weightedEdges.size()
+               && weightedEdges[end].attribute == weightedEdges[begin].attribute)
+            ++end;
+
+        #pragma omp parallel for if (end - begin > 1024)
+        for (omp_index i = begin; i < static_cast<omp_index>(end); ++i)
+            selected[i] = !uf.inSameSet(weightedEdges[i].u, weightedEdges[i].v);
+
+        for (index i = begin; i < end; ++i) {
+            if (!selected[i])
+                continue;
+            const weightedEdge &e = weightedEdges[i];
             if (useEdgeWeights) {
                 umsf.addEdge(e.u, e.v, e.attribute);
             } else {
@@ -72,10 +75,12 @@ void UnionMaximumSpanningForest::run() {
             if (calculateAttribute) {
                 umsfAttribute[e.eid] = true;
             }
-
-            nodesToMerge.emplace_back(e.u, e.v);
-
         }
+
+        #pragma omp parallel for if (end - begin > 1024)
+        for (omp_index i = begin; i < static_cast<omp_index>(end); ++i)
+            if (selected[i])
+                uf.unite(weightedEdges[i].u, weightedEdges[i].v);
     }
 
     handler.assureRunning();
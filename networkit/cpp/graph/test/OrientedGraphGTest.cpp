@@ -0,0 +1,126 @@
+/*
+ * OrientedGraphGTest.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/OrientedGraph.hpp>
+
+namespace NetworKit {
+
+class OrientedGraphGTest : public testing::TestWithParam<OrientedGraph::Ordering> {};
+
+INSTANTIATE_TEST_CASE_P(InstantiationName, OrientedGraphGTest,
+                        testing::Values(OrientedGraph::Ordering::DEGREE,
+                                        OrientedGraph::Ordering::DEGENERACY), );
+
+TEST_P(OrientedGraphGTest, testOrientation) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.05).generate();
+    G.removeNode(7);
+    const OrientedGraph oriented(G, GetParam());
+
+    count entries = 0, maxOutDegree = 0;
+    G.forNodes([&](node u) {
+        const count deg = oriented.outDegree(u);
+        const node *out = oriented.outNeighbors(u);
+        EXPECT_TRUE(std::is_sorted(out, out + deg));
+        for (index i = 0; i < deg; ++i) {
+            EXPECT_TRUE(G.hasEdge(u, out[i]));
+            EXPECT_LT(oriented.rank(u), oriented.rank(out[i]));
+        }
+        entries += deg;
+        maxOutDegree = std::max(maxOutDegree, deg);
+    });
+
+    EXPECT_EQ(entries, G.numberOfEdges());
+    EXPECT_EQ(oriented.maxOutDegree(), maxOutDegree);
+}
+
+TEST_P(OrientedGraphGTest, testSelfLoopsAreIgnored) {
+    Graph G(4);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    G.addEdge(0, 2);
+    G.addEdge(2, 3);
+    G.addEdge(1, 1);
+    G.addEdge(3, 3);
+    const OrientedGraph oriented(G, GetParam());
+
+    count entries = 0;
+    G.forNodes([&](node u) { entries += oriented.outDegree(u); });
+    EXPECT_EQ(entries, 4u);
+    EXPECT_EQ(oriented.numberOfTriangles(), 1u);
+}
+
+TEST_P(OrientedGraphGTest, testTrianglesAgainstBruteForce) {
+    Aux::Random::setSeed(42, false);
+
+    for (int iter = 0; iter < 3; ++iter) {
+        Graph G = ErdosRenyiGenerator(100, 0.2).generate();
+        G.indexEdges();
+        const OrientedGraph oriented(G, GetParam(), true);
+
+        count expectedTotal = 0;
+        std::vector<count> expectedPerNode(G.upperNodeIdBound(), 0);
+        std::vector<count> expectedPerEdge(G.upperEdgeIdBound(), 0);
+        G.forNodes([&](node u) {
+            G.forNeighborsOf(u, [&](node v) {
+                G.forNeighborsOf(v, [&](node w) {
+                    if (u < v && v < w && G.hasEdge(u, w)) {
+                        ++expectedTotal;
+                        ++expectedPerNode[u];
+                        ++expectedPerNode[v];
+                        ++expectedPerNode[w];
+                        ++expectedPerEdge[G.edgeId(u, v)];
+                        ++expectedPerEdge[G.edgeId(u, w)];
+                        ++expectedPerEdge[G.edgeId(v, w)];
+                    }
+                });
+            });
+        });
+
+        EXPECT_EQ(oriented.numberOfTriangles(), expectedTotal);
+        EXPECT_EQ(oriented.trianglesPerNode(), expectedPerNode);
+        EXPECT_EQ(oriented.trianglesPerEdge(), expectedPerEdge);
+
+        std::mutex mutex;
+        count listed = 0;
+        oriented.parallelForTrianglesWithEdgeIds(
+            [&](node u, node v, node w, edgeid uv, edgeid uw, edgeid vw) {
+                std::lock_guard<std::mutex> guard(mutex);
+                EXPECT_LT(oriented.rank(u), oriented.rank(v));
+                EXPECT_LT(oriented.rank(v), oriented.rank(w));
+                EXPECT_EQ(G.edgeId(u, v), uv);
+                EXPECT_EQ(G.edgeId(u, w), uw);
+                EXPECT_EQ(G.edgeId(v, w), vw);
+                ++listed;
+            });
+        EXPECT_EQ(listed, expectedTotal);
+    }
+}
+
+TEST_P(OrientedGraphGTest, testDegeneracyOfClique) {
+    // A 5-clique with a long path attached: every node has at most 4 out-neighbors.
+    Graph G(20);
+    for (node u = 0; u < 5; ++u)
+        for (node v = u + 1; v < 5; ++v)
+            G.addEdge(u, v);
+    for (node u = 4; u + 1 < 20; ++u)
+        G.addEdge(u, u + 1);
+
+    const OrientedGraph oriented(G, GetParam());
+    EXPECT_EQ(oriented.maxOutDegree(), 4);
+    EXPECT_EQ(oriented.numberOfTriangles(), 10);
+    EXPECT_FALSE(oriented.hasEdgeIds());
+    EXPECT_THROW(oriented.trianglesPerEdge(), std::runtime_error);
+}
+
+} // namespace NetworKit
@@ -10,6 +10,7 @@
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/graph/KruskalMSF.hpp>
 #include <networkit/graph/SpanningForest.hpp>
+#include <networkit/graph/UnionMaximumSpanningForest.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 
 namespace NetworKit {
@@ -54,4 +55,29 @@ TEST_F(SpanningGTest, testSpanningForest) {
     }
 }
 
+TEST_F(SpanningGTest, testUnionMaximumSpanningForest) {
+    // A triangle of equal weight with a pendant path 2-3-4 of lower weight, and an edge 1-3
+    // that closes a cycle of heavier edges.
+    Graph G(5, true);
+    G.addEdge(0, 1, 3.0);
+    G.addEdge(1, 2, 3.0);
+    G.addEdge(0, 2, 3.0);
+    G.addEdge(2, 3, 2.0);
+    G.addEdge(3, 4, 2.0);
+    G.addEdge(1, 3, 1.0);
+    G.indexEdges();
+
+    UnionMaximumSpanningForest umsf(G);
+    umsf.run();
+    Graph T = umsf.getUMSF();
+
+    EXPECT_EQ(T.numberOfEdges(), 5);
+    EXPECT_TRUE(T.hasEdge(0, 1));
+    EXPECT_TRUE(T.hasEdge(1, 2));
+    EXPECT_TRUE(T.hasEdge(0, 2));
+    EXPECT_TRUE(T.hasEdge(2, 3));
+    EXPECT_TRUE(T.hasEdge(3, 4));
+    EXPECT_FALSE(umsf.inUMSF(1, 3));
+}
+
 } /* namespace NetworKit */
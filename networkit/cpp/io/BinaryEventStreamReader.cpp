@@ -0,0 +1,143 @@
+/*
+ * BinaryEventStreamReader.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <networkit/io/BinaryEventStreamReader.hpp>
+
+namespace NetworKit {
+
+BinaryEventStreamReader::BinaryEventStreamReader(const std::string &path) : file(path) {
+    if (file.size() < sizeof(header))
+        throw std::runtime_error("Error, " + path + " is not a binary event stream");
+    std::memcpy(&header, &*file.cbegin(), sizeof(header));
+    if (std::memcmp(nkbes::MAGIC, header.magic, sizeof(header.magic)))
+        throw std::runtime_error("Reader expected another magic value");
+    if (header.offsetIndex < sizeof(header) || header.offsetIndex > file.size()
+        || (file.size() - header.offsetIndex) / sizeof(nkbes::IndexEntry) != header.blocks)
+        throw std::runtime_error("Error, the index of " + path + " is corrupted");
+
+    blockIndex.resize(header.blocks);
+    std::memcpy(blockIndex.data(), &*file.cbegin() + header.offsetIndex,
+                header.blocks * sizeof(nkbes::IndexEntry));
+    for (index b = 0; b < header.blocks; ++b) {
+        const auto &entry = blockIndex[b];
+        const uint64_t nextOffset = b + 1 < header.blocks ? blockIndex[b + 1].offset
+                                                          : header.offsetIndex;
+        const uint64_t nextEvent = b + 1 < header.blocks ? blockIndex[b + 1].firstEvent
+                                                         : header.events;
+        if (entry.offset < sizeof(header) || entry.offset > nextOffset
+            || entry.firstEvent >= nextEvent)
+            throw std::runtime_error("Error, the index of " + path + " is corrupted");
+    }
+    if (header.blocks ? blockIndex.front().firstEvent != 0 : header.events != 0)
+        throw std::runtime_error("Error, the index of " + path + " is corrupted");
+
+    if (header.blocks)
+        startBlock(0);
+}
+
+const uint8_t *BinaryEventStreamReader::blockBegin(index b) const {
+    return reinterpret_cast<const uint8_t *>(&*file.cbegin()) + blockIndex[b].offset;
+}
+
+const uint8_t *BinaryEventStreamReader::blockEnd(index b) const {
+    return reinterpret_cast<const uint8_t *>(&*file.cbegin())
+           + (b + 1 < header.blocks ? blockIndex[b + 1].offset : header.offsetIndex);
+}
+
+count BinaryEventStreamReader::blockSize(index b) const {
+    return (b + 1 < header.blocks ? blockIndex[b + 1].firstEvent : header.events)
+           - blockIndex[b].firstEvent;
+}
+
+void BinaryEventStreamReader::startBlock(index b) {
+    block = b;
+    position = blockIndex[b].firstEvent;
+    cursor = blockBegin(b);
+    lastU = 0;
+}
+
+GraphEvent BinaryEventStreamReader::decodeNext() {
+    GraphEvent event;
+    const size_t bytes = nkbes::decodeEvent(cursor, blockEnd(block), lastU, event);
+    if (!bytes)
+        throw std::runtime_error("Error, block " + std::to_string(block) + " is corrupted");
+    cursor += bytes;
+    ++position;
+    if (position < header.events && block + 1 < header.blocks
+        && position == blockIndex[block + 1].firstEvent)
+        startBlock(block + 1);
+    return event;
+}
+
+std::vector<GraphEvent> BinaryEventStreamReader::read() const {
+    std::vector<GraphEvent> events(header.events);
+    bool corrupted = false;
+#pragma omp parallel for schedule(dynamic) reduction(|| : corrupted)
+    for (omp_index b = 0; b < static_cast<omp_index>(header.blocks); ++b) {
+        const uint8_t *it = blockBegin(b);
+        const uint8_t *end = blockEnd(b);
+        node last = 0;
+        const index first = blockIndex[b].firstEvent;
+        bool valid = true;
+        for (index i = first; valid && i < first + blockSize(b); ++i) {
+            const size_t bytes = nkbes::decodeEvent(it, end, last, events[i]);
+            valid = bytes > 0;
+            it += bytes;
+        }
+        corrupted = corrupted || !valid || it != end;
+    }
+    if (corrupted)
+        throw std::runtime_error("Error, the binary event stream is corrupted");
+    return events;
+}
+
+std::vector<GraphEvent> BinaryEventStreamReader::nextBatch(count maxEvents) {
+    std::vector<GraphEvent> events;
+    events.reserve(std::min<count>(maxEvents, header.events - position));
+    while (events.size() < maxEvents && hasNext())
+        events.push_back(decodeNext());
+    return events;
+}
+
+void BinaryEventStreamReader::seek(index event) {
+    if (event > header.events)
+        throw std::runtime_error("Error, event " + std::to_string(event) + " does not exist");
+    if (event == header.events) {
+        position = event;
+        return;
+    }
+    const auto it = std::upper_bound(
+        blockIndex.begin(), blockIndex.end(), event,
+        [](index e, const nkbes::IndexEntry &entry) { return e < entry.firstEvent; });
+    startBlock(it - blockIndex.begin() - 1);
+    while (position < event)
+        decodeNext();
+}
+
+void BinaryEventStreamReader::seekTimeStep(count t) {
+    if (t > header.timeSteps)
+        throw std::runtime_error("Error, time step " + std::to_string(t) + " does not exist");
+    if (t == 0) {
+        seek(0);
+        return;
+    }
+    // The last block that starts before the t-th time step contains it.
+    const auto it = std::lower_bound(
+        blockIndex.begin(), blockIndex.end(), t,
+        [](const nkbes::IndexEntry &entry, count step) { return entry.firstTimeStep < step; });
+    startBlock(it - blockIndex.begin() - 1);
+    count steps = blockIndex[block].firstTimeStep;
+    while (steps < t)
+        steps += decodeNext().type == GraphEvent::TIME_STEP;
+}
+
+} // namespace NetworKit
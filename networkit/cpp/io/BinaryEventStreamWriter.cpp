@@ -0,0 +1,96 @@
+/*
+ * BinaryEventStreamWriter.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include <networkit/auxiliary/Enforce.hpp>
+#include <networkit/io/BinaryEventStream.hpp>
+#include <networkit/io/BinaryEventStreamWriter.hpp>
+
+namespace NetworKit {
+
+BinaryEventStreamWriter::BinaryEventStreamWriter(count eventsPerBlock)
+    : eventsPerBlock(eventsPerBlock) {
+    if (!eventsPerBlock)
+        throw std::runtime_error("Error, a block must contain at least one event.");
+}
+
+void BinaryEventStreamWriter::write(const std::vector<GraphEvent> &stream,
+                                    const std::string &path) {
+    writeParts({{stream.data(), stream.size()}}, path);
+}
+
+void BinaryEventStreamWriter::write(const GraphDifference &difference, const std::string &path) {
+    std::vector<std::pair<const GraphEvent *, count>> parts;
+    for (const auto &chunk : difference.getEditChunks())
+        parts.emplace_back(chunk.data(), chunk.size());
+    writeParts(parts, path);
+}
+
+void BinaryEventStreamWriter::writeParts(
+    const std::vector<std::pair<const GraphEvent *, count>> &parts, const std::string &path) {
+    // First event of every part.
+    std::vector<index> partBegin(parts.size() + 1, 0);
+    for (index p = 0; p < parts.size(); ++p)
+        partBegin[p + 1] = partBegin[p] + parts[p].second;
+    const count numEvents = partBegin.back();
+    const count numBlocks = (numEvents + eventsPerBlock - 1) / eventsPerBlock;
+
+    // Blocks are independent, so they are encoded in parallel.
+    std::vector<std::vector<uint8_t>> blocks(numBlocks);
+    std::vector<count> timeSteps(numBlocks, 0);
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index b = 0; b < static_cast<omp_index>(numBlocks); ++b) {
+        const index begin = b * eventsPerBlock;
+        const index end = std::min<index>(begin + eventsPerBlock, numEvents);
+        // Last part that starts at or before the block.
+        const auto next = std::upper_bound(partBegin.begin(), partBegin.end(), begin);
+        index p = static_cast<index>(next - partBegin.begin()) - 1;
+        node lastU = 0;
+        for (index i = begin; i < end; ++i) {
+            while (i == partBegin[p + 1])
+                ++p;
+            const GraphEvent &event = parts[p].first[i - partBegin[p]];
+            nkbes::encodeEvent(event, lastU, blocks[b]);
+            timeSteps[b] += event.type == GraphEvent::TIME_STEP;
+        }
+    }
+
+    nkbes::Header header;
+    std::memcpy(header.magic, nkbes::MAGIC, sizeof(header.magic));
+    header.events = numEvents;
+    header.blocks = numBlocks;
+
+    std::vector<nkbes::IndexEntry> blockIndex(numBlocks);
+    uint64_t offset = sizeof(header);
+    uint64_t numTimeSteps = 0;
+    for (index b = 0; b < numBlocks; ++b) {
+        blockIndex[b].offset = offset;
+        blockIndex[b].firstEvent = b * eventsPerBlock;
+        blockIndex[b].firstTimeStep = numTimeSteps;
+        offset += blocks[b].size();
+        numTimeSteps += timeSteps[b];
+    }
+    header.timeSteps = numTimeSteps;
+    header.offsetIndex = offset;
+
+    std::ofstream outfile(path, std::ios::binary);
+    Aux::enforceOpened(outfile);
+    outfile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto &block : blocks)
+        outfile.write(reinterpret_cast<const char *>(block.data()), block.size());
+    outfile.write(reinterpret_cast<const char *>(blockIndex.data()),
+                  blockIndex.size() * sizeof(nkbes::IndexEntry));
+    if (!outfile)
+        throw std::runtime_error("Error, could not write to " + path);
+}
+
+} // namespace NetworKit
@@ -3,24 +3,17 @@
 #include <fstream>
 
 #include <networkit/io/CoverWriter.hpp>
+#include <networkit/structures/CompactCover.hpp>
 
 namespace NetworKit {
 
 void CoverWriter::write(Cover &zeta, const std::string &path) const {
     std::ofstream file{path};
 
-    std::vector<std::vector<index>> sets(zeta.upperBound());
-    zeta.forEntries([&](index v, const std::set<index> &c) {
-        for (auto &s : c) {
-            sets[s].push_back(v);
-        }
-    });
-
-    for (auto &nodes : sets) {
-        for (auto &v : nodes) {
-            file << v << " ";
-        }
-        file << std::endl;
+    const CompactCover sets(zeta);
+    for (index s = 0; s < sets.upperBound(); ++s) {
+        sets.forMembersOf(s, [&](index v) { file << v << " "; });
+        file << '\n';
     }
 }
 
@@ -7,12 +7,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
 #include <iostream>
 #include <fstream>
 #include <limits>
+#include <random>
 #include <unordered_set>
 #include <vector>
 
@@ -43,6 +45,8 @@
 #include <networkit/io/BinaryPartitionReader.hpp>
 #include <networkit/io/BinaryEdgeListPartitionWriter.hpp>
 #include <networkit/io/BinaryEdgeListPartitionReader.hpp>
+#include <networkit/io/BinaryEventStreamReader.hpp>
+#include <networkit/io/BinaryEventStreamWriter.hpp>
 #include <networkit/io/NetworkitBinaryGraph.hpp>
 #include <networkit/io/NetworkitBinaryReader.hpp>
 #include <networkit/io/NetworkitBinaryWriter.hpp>
@@ -50,11 +54,13 @@
 
 #include <networkit/community/GraphClusteringTools.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
 #include <networkit/structures/Partition.hpp>
 #include <networkit/community/Modularity.hpp>
 #include <networkit/community/PLP.hpp>
 #include <networkit/dynamics/GraphDifference.hpp>
+#include <networkit/dynamics/GraphUpdater.hpp>
 
 #include <tlx/unused.hpp>
 
@@ -1050,4 +1056,116 @@ TEST_F(IOGTest, testNetworkitBinaryZigzag) {
     }
 }
 
+TEST_F(IOGTest, testBinaryEventStream) {
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<node> nodeDistr(0, 1000000);
+    std::uniform_int_distribution<int> typeDistr(0, 7);
+    std::vector<GraphEvent> stream;
+    for (count i = 0; i < 10000; ++i) {
+        const auto type = static_cast<GraphEvent::Type>(typeDistr(gen));
+        const node u = nodeDistr(gen), v = nodeDistr(gen);
+        switch (i % 5) {
+        case 0:
+            stream.emplace_back(type, u, v);
+            break;
+        case 1:
+            stream.emplace_back(type, u, v, static_cast<edgeweight>(static_cast<int>(u) - 500000));
+            break;
+        case 2:
+            stream.emplace_back(type, u, v, 0.25);
+            break;
+        case 3:
+            stream.emplace_back(type, u, none, 1.0 / 3);
+            break;
+        default:
+            stream.emplace_back(type);
+        }
+    }
+    stream.emplace_back(GraphEvent::EDGE_ADDITION, std::numeric_limits<node>::max() - 1, 0,
+                        std::numeric_limits<edgeweight>::max());
+    const count numTimeSteps = std::count_if(stream.begin(), stream.end(), [](const GraphEvent &ev) {
+        return ev.type == GraphEvent::TIME_STEP;
+    });
+
+    auto expectEqual = [](const GraphEvent &expected, const GraphEvent &actual) {
+        EXPECT_EQ(expected.type, actual.type);
+        EXPECT_EQ(expected.u, actual.u);
+        EXPECT_EQ(expected.v, actual.v);
+        EXPECT_EQ(expected.w, actual.w);
+    };
+
+    for (count eventsPerBlock : {1, 7, 4096, 100000}) {
+        BinaryEventStreamWriter writer(eventsPerBlock);
+        writer.write(stream, "output/events.nkbes");
+        BinaryEventStreamReader reader("output/events.nkbes");
+        ASSERT_EQ(reader.numberOfEvents(), stream.size());
+        EXPECT_EQ(reader.numberOfTimeSteps(), numTimeSteps);
+
+        const auto events = reader.read();
+        ASSERT_EQ(events.size(), stream.size());
+        for (index i = 0; i < stream.size(); ++i)
+            expectEqual(stream[i], events[i]);
+
+        index i = 0;
+        while (reader.hasNext()) {
+            const auto batch = reader.nextBatch(333);
+            ASSERT_LE(batch.size(), 333);
+            for (const auto &event : batch)
+                expectEqual(stream[i++], event);
+        }
+        EXPECT_EQ(i, stream.size());
+
+        for (index position : {index{0}, index{1}, index{5000}, stream.size() - 1}) {
+            reader.seek(position);
+            EXPECT_EQ(reader.tell(), position);
+            expectEqual(stream[position], reader.nextBatch(1).front());
+        }
+
+        for (count t : {count{0}, count{1}, numTimeSteps / 2, numTimeSteps}) {
+            reader.seekTimeStep(t);
+            count steps = std::count_if(
+                stream.begin(), stream.begin() + reader.tell(),
+                [](const GraphEvent &ev) { return ev.type == GraphEvent::TIME_STEP; });
+            EXPECT_EQ(steps, t);
+            if (t > 0)
+                EXPECT_EQ(stream[reader.tell() - 1].type, GraphEvent::TIME_STEP);
+        }
+    }
+}
+
+TEST_F(IOGTest, testBinaryEventStreamCorrupted) {
+    const std::string path = "output/corrupted.nkbes";
+    BinaryEventStreamWriter().write({GraphEvent(GraphEvent::EDGE_ADDITION, 0, 1)}, path);
+
+    // Claim a double weight that the block does not contain.
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(sizeof(nkbes::Header));
+        const char flags = GraphEvent::EDGE_ADDITION | (nkbes::DOUBLE << nkbes::WGHT_SHIFT);
+        file.write(&flags, 1);
+    }
+
+    BinaryEventStreamReader reader(path);
+    EXPECT_THROW(reader.read(), std::runtime_error);
+    EXPECT_THROW(reader.nextBatch(1), std::runtime_error);
+}
+
+TEST_F(IOGTest, testBinaryEventStreamGraphDifference) {
+    Aux::Random::setSeed(42, false);
+    Graph G1 = ErdosRenyiGenerator(500, 0.02).generate();
+    Graph G2 = ErdosRenyiGenerator(500, 0.02).generate();
+    GraphDifference difference(G1, G2);
+    difference.run();
+
+    BinaryEventStreamWriter writer(100);
+    writer.write(difference, "output/difference.nkbes");
+    const auto edits = BinaryEventStreamReader("output/difference.nkbes").read();
+    EXPECT_EQ(edits.size(), difference.getEdits().size());
+
+    GraphUpdater updater(G1);
+    updater.update(edits);
+    EXPECT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+    G2.forEdges([&](node u, node v) { EXPECT_TRUE(G1.hasEdge(u, v)); });
+}
+
 } /* namespace NetworKit */
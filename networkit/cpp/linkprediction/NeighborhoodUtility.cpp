@@ -5,6 +5,7 @@
  *      Author: Kolja Esders
  */
 
+#include <networkit/auxiliary/SortedIntersection.hpp>
 #include <networkit/linkprediction/NeighborhoodUtility.hpp>
 
 namespace NetworKit {
@@ -35,10 +36,15 @@ std::vector<node> NeighborhoodUtility::getCommonNeighbors(const Graph& G, node u
     throw std::invalid_argument("Invalid node provided.");
   }
   std::pair<std::vector<node>, std::vector<node>> neighborhoods = getSortedNeighborhoods(G, u, v);
-  std::vector<node> commonNeighbors;
-  std::set_intersection(neighborhoods.first.begin(), neighborhoods.first.end(), neighborhoods.second.begin(),
-    neighborhoods.second.end(), std::back_inserter(commonNeighbors));
-  return commonNeighbors;
+  return Aux::SortedIntersection::intersect(neighborhoods.first, neighborhoods.second);
+}
+
+count NeighborhoodUtility::getNumberOfCommonNeighbors(const Graph& G, node u, node v) {
+  if (!G.hasNode(u) || !G.hasNode(v)) {
+    throw std::invalid_argument("Invalid node provided.");
+  }
+  std::pair<std::vector<node>, std::vector<node>> neighborhoods = getSortedNeighborhoods(G, u, v);
+  return Aux::SortedIntersection::intersectionSize(neighborhoods.first, neighborhoods.second);
 }
 
 } // namespace NetworKit
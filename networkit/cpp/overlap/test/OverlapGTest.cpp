@@ -104,6 +104,31 @@ TEST_F(OverlapGTest, testHashingOverlapperForCorrectness) {
     EXPECT_TRUE(std::is_permutation(overlapping_origin.begin(),overlapping_origin.end(),overlapping_comparison.begin()));
 }
 
+TEST_F(OverlapGTest, testHashingOverlapperWithHashedIds) {
+    // The overlapper uses hashes as subset ids before compacting them.
+    count n = 10;
+    Graph G(n);
+    G.forNodePairs([&](node u, node v) { G.addEdge(u, v); });
+
+    Partition zeta(n);
+    Partition eta(n);
+    zeta.setUpperBound(2);
+    eta.setUpperBound(3);
+    for (node u = 0; u < n; ++u) {
+        zeta[u] = u % 2;
+        eta[u] = u % 3;
+    }
+
+    std::vector<Partition> clusterings = {zeta, eta};
+    HashingOverlapper overlapper;
+    Partition overlap = overlapper.run(G, clusterings);
+    EXPECT_EQ(overlap.numberOfSubsets(), 6);
+    EXPECT_EQ(overlap.upperBound(), 6);
+    for (node u = 0; u < n; ++u)
+        for (node v = 0; v < n; ++v)
+            EXPECT_EQ(overlap[u] == overlap[v], u % 6 == v % 6);
+}
+
 TEST_F(OverlapGTest, debugHashingOverlapperCorrectness) {
     count n = 2;
     Graph G(n);
@@ -11,10 +11,11 @@
 
 namespace NetworKit {
 
-ApproximatePageRank::ApproximatePageRank(const Graph& g, double alpha_, double epsilon):
-        G(&g), alpha(alpha_), eps(epsilon) {}
+ApproximatePageRank::ApproximatePageRank(const Graph& g, double alpha_, double epsilon, count maxSupport):
+        G(&g), alpha(alpha_), eps(epsilon), maxSupport(maxSupport) {}
 
 std::vector<std::pair<node, double>> ApproximatePageRank::run(node seed) {
+    pr_res.clear();
     pr_res[seed] = std::make_pair(0.0, 1.0);
     std::queue<node> activeNodes;
     activeNodes.push(seed);
@@ -40,7 +41,7 @@ std::vector<std::pair<node, double>> ApproximatePageRank::run(node seed) {
         }
     };
 
-    while (!activeNodes.empty()) {
+    while (!activeNodes.empty() && pr_res.size() < maxSupport) {
         node v =  activeNodes.front();
         activeNodes.pop();
         push(v, activeNodes);
@@ -8,6 +8,7 @@
 
 #include <utility>
 #include <networkit/scd/GCE.hpp>
+#include <networkit/scd/ParallelSeedExpansion.hpp>
 
 namespace {
     template <bool> struct ConditionalCount {
@@ -42,16 +43,14 @@ GCE::GCE(const Graph &G, std::string objective)
 }
 
 std::map<node, std::set<node> >  GCE::run(const std::set<node>& seeds) {
-    std::map<node, std::set<node> > result;
-    for (auto seed : seeds) {
-        result[seed] = expandSeed(seed);
-    }
-    return result;
+    ParallelSeedExpansion expansion(*this, std::vector<node>(seeds.begin(), seeds.end()));
+    expansion.run();
+    return expansion.getCommunityMap();
 }
 
 
 template <bool objectiveIsM>
-std::set<node> expandseed_internal(const Graph&G, node s) {
+std::set<node> expandseed_internal(const Graph&G, node s, count maxSize) {
     /**
     * Check if set contains node.
     */
@@ -269,16 +268,16 @@ std::set<node> expandseed_internal(const Graph&G, node s) {
             currentQ += dQMax;   // update current community quality
             TRACE("community: ", community);
         }
-    } while (vMax != none);
+    } while (vMax != none && community.size() < maxSize);
 
     return community;
 }
 
 std::set<node> GCE::expandSeed(node s) {
     if (objective == "M") {
-        return expandseed_internal<true>(*G, s);
+        return expandseed_internal<true>(*G, s, budget);
     } else if (objective == "L") {
-        return expandseed_internal<false>(*G, s);
+        return expandseed_internal<false>(*G, s, budget);
     } else {
         throw std::runtime_error("unknown objective function");
     }
@@ -12,6 +12,7 @@
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/scd/ApproximatePageRank.hpp>
 #include <networkit/scd/PageRankNibble.hpp>
+#include <networkit/scd/ParallelSeedExpansion.hpp>
 
 namespace NetworKit {
 
@@ -81,18 +82,15 @@ std::set<node> PageRankNibble::bestSweepSet(std::vector<std::pair<node, double>>
 
 std::set<node> PageRankNibble::expandSeed(node seed) {
     DEBUG("APR(G, ", alpha, ", ", epsilon, ")");
-    ApproximatePageRank apr(*G, alpha, epsilon);
+    ApproximatePageRank apr(*G, alpha, epsilon, budget);
     std::vector<std::pair<node, double>> pr = apr.run(seed);
     return bestSweepSet(pr);
 }
 
 std::map<node, std::set<node> >  PageRankNibble::run(const std::set<node>& seeds) {
-    std::map<node, std::set<node> > result;
-    for (auto seed : seeds) {
-        auto community = expandSeed(seed);
-        result[seed] = community;
-    }
-    return result;
+    ParallelSeedExpansion expansion(*this, std::vector<node>(seeds.begin(), seeds.end()));
+    expansion.run();
+    return expansion.getCommunityMap();
 }
 
 } /* namespace NetworKit */
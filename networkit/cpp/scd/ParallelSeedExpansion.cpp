@@ -0,0 +1,68 @@
+/*
+ * ParallelSeedExpansion.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <omp.h>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/scd/ParallelSeedExpansion.hpp>
+
+namespace NetworKit {
+
+ParallelSeedExpansion::ParallelSeedExpansion(SelectiveCommunityDetector &detector,
+                                             std::vector<node> seeds)
+    : detector(&detector), seeds(std::move(seeds)) {}
+
+void ParallelSeedExpansion::run() {
+    Aux::SignalHandler handler;
+    const count numSeeds = seeds.size();
+    offsets.assign(numSeeds + 1, 0);
+
+    // Per thread: the members of the expanded communities and, for every community, its seed
+    // index and its position in the buffer.
+    const count numThreads = omp_get_max_threads();
+    std::vector<std::vector<node>> buffers(numThreads);
+    std::vector<std::vector<std::pair<index, index>>> positions(numThreads);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index i = 0; i < static_cast<omp_index>(numSeeds); ++i) {
+        if (!handler.isRunning())
+            continue;
+        const index tid = omp_get_thread_num();
+        const std::set<node> community = detector->expandSeed(seeds[i]);
+        positions[tid].emplace_back(i, buffers[tid].size());
+        buffers[tid].insert(buffers[tid].end(), community.begin(), community.end());
+        offsets[i + 1] = community.size();
+    }
+    handler.assureRunning();
+
+    for (index i = 0; i < numSeeds; ++i)
+        offsets[i + 1] += offsets[i];
+
+    members.resize(offsets[numSeeds]);
+#pragma omp parallel for schedule(static, 1)
+    for (omp_index t = 0; t < static_cast<omp_index>(numThreads); ++t) {
+        for (const auto &position : positions[t]) {
+            const index i = position.first;
+            std::copy_n(buffers[t].begin() + position.second, offsets[i + 1] - offsets[i],
+                        members.begin() + offsets[i]);
+        }
+    }
+
+    hasRun = true;
+}
+
+std::map<node, std::set<node>> ParallelSeedExpansion::getCommunityMap() const {
+    assureFinished();
+    std::map<node, std::set<node>> result;
+    for (index i = 0; i < seeds.size(); ++i)
+        result[seeds[i]] = std::set<node>(community(i), community(i) + communitySize(i));
+    return result;
+}
+
+} // namespace NetworKit
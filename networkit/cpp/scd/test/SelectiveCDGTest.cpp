@@ -9,6 +9,7 @@
 #include <networkit/io/SNAPGraphReader.hpp>
 #include <networkit/scd/GCE.hpp>
 #include <networkit/scd/PageRankNibble.hpp>
+#include <networkit/scd/ParallelSeedExpansion.hpp>
 #include <networkit/scd/ApproximatePageRank.hpp>
 #include <networkit/scd/SelectiveCommunityDetector.hpp>
 
@@ -65,5 +66,59 @@ TEST_F(SCDGTest2, testSCD) {
     }
 }
 
+TEST_F(SCDGTest2, testParallelSeedExpansion) {
+    METISGraphReader reader;
+    Graph G = reader.read("input/hep-th.graph");
+    const std::vector<node> seeds = {50, 7, 123, 50, 4000};
+
+    PageRankNibble prn(G, 0.1, 1e-5);
+    GCE gceL(G, "L");
+    GCE gceM(G, "M");
+    for (SelectiveCommunityDetector *detector :
+         std::vector<SelectiveCommunityDetector *>{&prn, &gceL, &gceM}) {
+        ParallelSeedExpansion expansion(*detector, seeds);
+        expansion.run();
+        ASSERT_EQ(expansion.numberOfSeeds(), seeds.size());
+        EXPECT_EQ(expansion.getOffsets().back(), expansion.getMembers().size());
+
+        for (index i = 0; i < seeds.size(); ++i) {
+            const std::set<node> expected = detector->expandSeed(seeds[i]);
+            const std::vector<node> community(expansion.community(i),
+                                              expansion.community(i) + expansion.communitySize(i));
+            EXPECT_EQ(community, std::vector<node>(expected.begin(), expected.end()));
+        }
+
+        const auto communities = expansion.getCommunityMap();
+        EXPECT_EQ(communities.size(), 4u);
+        EXPECT_EQ(communities, detector->run(std::set<node>(seeds.begin(), seeds.end())));
+    }
+}
+
+TEST_F(SCDGTest2, testSeedExpansionBudget) {
+    METISGraphReader reader;
+    Graph G = reader.read("input/hep-th.graph");
+    const node seed = 50;
+
+    GCE gce(G, "M");
+    const count unlimited = gce.expandSeed(seed).size();
+    ASSERT_GT(unlimited, 3u);
+    gce.setBudget(3);
+    EXPECT_EQ(gce.expandSeed(seed).size(), 3u);
+    EXPECT_TRUE(gce.expandSeed(seed).count(seed));
+
+    ApproximatePageRank apr(G, 0.1, 1e-5);
+    const count support = apr.run(seed).size();
+    ASSERT_GT(support, 10u);
+    // The result does not depend on previous runs.
+    EXPECT_EQ(apr.run(seed).size(), support);
+
+    ApproximatePageRank limited(G, 0.1, 1e-5, 10);
+    EXPECT_LT(limited.run(seed).size(), support);
+
+    PageRankNibble prn(G, 0.1, 1e-5);
+    prn.setBudget(10);
+    EXPECT_LT(prn.expandSeed(seed).size(), support);
+}
+
 
 } /* namespace NetworKit */
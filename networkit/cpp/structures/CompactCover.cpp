@@ -0,0 +1,126 @@
+/*
+ * CompactCover.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/structures/CompactCover.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Returns one plus the largest id in ids, or upper if that is larger.
+index idBound(const std::vector<index> &ids, index upper) {
+    index maxId = 0;
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(max : maxId)
+    for (omp_index i = 0; i < static_cast<omp_index>(ids.size()); ++i)
+        maxId = std::max(maxId, ids[i] + 1);
+#else
+    for (const index id : ids)
+        maxId = std::max(maxId, id + 1);
+#endif
+    return std::max(maxId, upper);
+}
+
+} // namespace
+
+CompactCover::CompactCover(const Partition &zeta) {
+    const count n = zeta.numberOfElements();
+    elementOffsets.assign(n + 1, 0);
+    zeta.parallelForEntries([&](index e, index s) { elementOffsets[e + 1] = (s != none); });
+    for (index e = 0; e < n; ++e)
+        elementOffsets[e + 1] += elementOffsets[e];
+
+    subsets.resize(elementOffsets[n]);
+    zeta.parallelForEntries([&](index e, index s) {
+        if (s != none)
+            subsets[elementOffsets[e]] = s;
+    });
+
+    buildMemberLists(idBound(subsets, zeta.upperBound()));
+}
+
+CompactCover::CompactCover(const Cover &zeta) {
+    const count n = zeta.numberOfElements();
+    elementOffsets.assign(n + 1, 0);
+    zeta.parallelForEntries(
+        [&](index e, const std::set<index> &s) { elementOffsets[e + 1] = s.size(); });
+    for (index e = 0; e < n; ++e)
+        elementOffsets[e + 1] += elementOffsets[e];
+
+    subsets.resize(elementOffsets[n]);
+    zeta.parallelForEntries([&](index e, const std::set<index> &s) {
+        std::copy(s.begin(), s.end(), subsets.begin() + elementOffsets[e]);
+    });
+
+    buildMemberLists(idBound(subsets, zeta.upperBound()));
+}
+
+void CompactCover::buildMemberLists(index upper) {
+    const count n = numberOfElements();
+    upperId = upper;
+
+    // Slot of every membership; for sparse ids, the slots are the positions in the sorted ids.
+    sparseIds = !isDenseIdRange(upper, n + subsets.size());
+    std::vector<index> sparseSlots;
+    index numSlots = upper;
+    if (sparseIds) {
+        subsetIds = subsets;
+        Aux::Parallel::sort(subsetIds.begin(), subsetIds.end());
+        subsetIds.erase(std::unique(subsetIds.begin(), subsetIds.end()), subsetIds.end());
+        numSlots = subsetIds.size();
+        sparseSlots.resize(subsets.size());
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(subsets.size()); ++i)
+            sparseSlots[i] = slot(subsets[i]);
+    }
+    const std::vector<index> &slots = sparseIds ? sparseSlots : subsets;
+
+    // Counting sort of the memberships by slot.
+    std::unique_ptr<std::atomic<index>[]> next(new std::atomic<index>[numSlots] {});
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(slots.size()); ++i)
+        next[slots[i]].fetch_add(1, std::memory_order_relaxed);
+
+    memberOffsets.assign(numSlots + 1, 0);
+    for (index s = 0; s < numSlots; ++s) {
+        memberOffsets[s + 1] = memberOffsets[s] + next[s].load(std::memory_order_relaxed);
+        next[s].store(memberOffsets[s], std::memory_order_relaxed);
+    }
+
+    members.resize(slots.size());
+#pragma omp parallel for schedule(guided)
+    for (omp_index e = 0; e < static_cast<omp_index>(n); ++e)
+        for (index i = elementOffsets[e]; i < elementOffsets[e + 1]; ++i)
+            members[next[slots[i]].fetch_add(1, std::memory_order_relaxed)] = e;
+
+    // The threads fill the buckets in arbitrary order.
+    count nonempty = 0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(+ : nonempty)
+    for (omp_index s = 0; s < static_cast<omp_index>(numSlots); ++s) {
+        if (memberOffsets[s] == memberOffsets[s + 1])
+            continue;
+        ++nonempty;
+        std::sort(members.begin() + memberOffsets[s], members.begin() + memberOffsets[s + 1]);
+    }
+    nonemptySubsets = nonempty;
+}
+
+std::vector<count> CompactCover::subsetSizes() const {
+    std::vector<count> sizes(upperBound());
+#pragma omp parallel for
+    for (omp_index s = 0; s < static_cast<omp_index>(sizes.size()); ++s)
+        sizes[s] = subsetSize(s);
+    return sizes;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,41 @@
+/*
+ * ConcurrentUnionFind.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/structures/ConcurrentUnionFind.hpp>
+
+namespace NetworKit {
+
+ConcurrentUnionFind::ConcurrentUnionFind(count numElements, bool randomizedLinking)
+    : n(numElements), parent(new std::atomic<index>[numElements]),
+      randomizedLinking(randomizedLinking), seed(randomizedLinking ? Aux::Random::integer() : 0) {
+    allToSingletons();
+}
+
+void ConcurrentUnionFind::allToSingletons() {
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u)
+        parent[u].store(static_cast<index>(u), std::memory_order_relaxed);
+}
+
+void ConcurrentUnionFind::compress() {
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u)
+        parent[u].store(find(static_cast<index>(u)), std::memory_order_relaxed);
+}
+
+Partition ConcurrentUnionFind::toPartition() {
+    Partition p(n);
+    p.setUpperBound(n);
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u)
+        p[u] = find(static_cast<index>(u));
+    return p;
+}
+
+} // namespace NetworKit
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 
+#include <networkit/structures/CompactCover.hpp>
 #include <networkit/structures/Cover.hpp>
 
 namespace NetworKit {
@@ -39,11 +40,13 @@ bool Cover::inSameSubset(index e1, index e2) const {
 std::set<index> Cover::getMembers(index s) const {
     assert (s <= omega);
     std::set<index> members;
+    std::vector<unsigned char> isMember(this->z + 1, 0);
+    this->parallelForEntries([&](index e, const std::set<index> &subsets) {
+        isMember[e] = subsets.count(s) > 0;
+    });
     for (index e = 0; e <= this->z; ++e) {
-        for (index t : data[e]) {
-            if (t == s) {
-                members.insert(e);
-            }
+        if (isMember[e]) {
+            members.emplace_hint(members.end(), e);
         }
     }
     return members;
@@ -112,34 +115,28 @@ index Cover::lowerBound() const {
 }
 
 std::vector<count> Cover::subsetSizes() const {
-    std::map<index,count> mapping;
-    std::vector<count> sizes;
-    count newIndex = 0;
-    for (index e = 0; e <= this->z; ++e) { // stores sizes in a vector
-        for (index t : data[e]) {
-            if (mapping.find(t) == mapping.end()) {
-                mapping[t] = newIndex++;
-                sizes.push_back(1);
-            } else {
-                sizes[mapping[t]]++;
-            }
-        }
+    // The sizes are listed in the order in which the subsets first occur, i.e., ordered by their
+    // smallest member and then by id.
+    const CompactCover members(*this);
+    std::vector<index> ids;
+    members.forSubsets([&](index t) { ids.push_back(t); });
+    std::stable_sort(ids.begin(), ids.end(), [&](index s, index t) {
+        return members.membersOf(s)[0] < members.membersOf(t)[0];
+    });
 
+    std::vector<count> sizes(ids.size());
+    for (index i = 0; i < ids.size(); ++i) {
+        sizes[i] = members.subsetSize(ids[i]);
     }
     return sizes;
 }
 
 std::map<index, count> Cover::subsetSizeMap() const {
+    const CompactCover members(*this);
     std::map<index,count> sizeMap;
-    for (index e = 0; e <= this->z; ++e) { // stores sizes of subsets in a map
-        for (index t : data[e]) {
-            if (sizeMap.find(t) == sizeMap.end()) {
-                sizeMap[t] = 1;
-            } else {
-                sizeMap[t]++;
-            }
-        }
-    }
+    members.forSubsets([&](index t) {
+        sizeMap.emplace_hint(sizeMap.end(), t, members.subsetSize(t));
+    });
     return sizeMap;
 }
 
@@ -182,10 +179,9 @@ void Cover::setUpperBound(index upper) {
 }
 
 std::set<index> Cover::getSubsetIds() const {
+    const CompactCover members(*this);
     std::set<index> ids;
-    for (const auto &subset : data) {
-        ids.insert(subset.begin(), subset.end());
-    }
+    members.forSubsets([&](index t) { ids.emplace_hint(ids.end(), t); });
     return ids;
 }
 
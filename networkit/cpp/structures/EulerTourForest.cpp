@@ -0,0 +1,237 @@
+/*
+ * EulerTourForest.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <algorithm>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/structures/EulerTourForest.hpp>
+
+namespace NetworKit {
+
+EulerTourForest::EulerTourForest(count numNodes) : vertex(numNodes, none) {}
+
+void EulerTourForest::addNodes(count numNodes) {
+    if (numNodes > vertex.size())
+        vertex.resize(numNodes, none);
+}
+
+index EulerTourForest::newElement(node from, node to) {
+    const Element element(from, to, Aux::Random::integer());
+    if (freeElements.empty()) {
+        elements.push_back(element);
+        return elements.size() - 1;
+    }
+    const index x = freeElements.back();
+    freeElements.pop_back();
+    elements[x] = element;
+    return x;
+}
+
+void EulerTourForest::freeElement(index x) {
+    freeElements.push_back(x);
+}
+
+index EulerTourForest::vertexElement(node u) {
+    if (vertex[u] == none)
+        vertex[u] = newElement(u, none);
+    return vertex[u];
+}
+
+index EulerTourForest::root(index x) const {
+    while (elements[x].parent != none)
+        x = elements[x].parent;
+    return x;
+}
+
+index EulerTourForest::position(index x) const {
+    auto sizeOf = [&](index y) { return y == none ? 0 : elements[y].size; };
+    index pos = sizeOf(elements[x].left);
+    for (index p = elements[x].parent; p != none; x = p, p = elements[p].parent)
+        if (elements[p].right == x)
+            pos += sizeOf(elements[p].left) + 1;
+    return pos;
+}
+
+void EulerTourForest::update(index x) {
+    Element &e = elements[x];
+    e.size = 1;
+    e.nodes = e.isNode();
+    e.minNode = e.isNode() ? e.from : none;
+    e.nodeMarks = e.isNode() && e.marked;
+    e.arcMarks = !e.isNode() && e.marked;
+    for (index c : {e.left, e.right}) {
+        if (c == none)
+            continue;
+        const Element &child = elements[c];
+        e.size += child.size;
+        e.nodes += child.nodes;
+        e.minNode = std::min(e.minNode, child.minNode);
+        e.nodeMarks = e.nodeMarks || child.nodeMarks;
+        e.arcMarks = e.arcMarks || child.arcMarks;
+    }
+}
+
+void EulerTourForest::updatePath(index x) {
+    for (; x != none; x = elements[x].parent)
+        update(x);
+}
+
+index EulerTourForest::merge(index a, index b) {
+    if (a == none)
+        return b;
+    if (b == none)
+        return a;
+    if (elements[a].priority > elements[b].priority) {
+        const index r = merge(elements[a].right, b);
+        elements[a].right = r;
+        elements[r].parent = a;
+        update(a);
+        return a;
+    }
+    const index l = merge(a, elements[b].left);
+    elements[b].left = l;
+    elements[l].parent = b;
+    update(b);
+    return b;
+}
+
+std::pair<index, index> EulerTourForest::split(index x, bool xLeft) {
+    index left, right;
+    if (xLeft) {
+        left = x;
+        right = elements[x].right;
+        elements[x].right = none;
+    } else {
+        right = x;
+        left = elements[x].left;
+        elements[x].left = none;
+    }
+    const index detached = xLeft ? right : left;
+    if (detached != none)
+        elements[detached].parent = none;
+    update(x);
+
+    // Walk up and distribute the ancestors to both sides.
+    index cur = x, p = elements[x].parent;
+    elements[x].parent = none;
+    while (p != none) {
+        const index grandparent = elements[p].parent;
+        if (elements[p].right == cur) {
+            elements[p].right = left;
+            if (left != none)
+                elements[left].parent = p;
+            left = p;
+        } else {
+            elements[p].left = right;
+            if (right != none)
+                elements[right].parent = p;
+            right = p;
+        }
+        elements[p].parent = none;
+        update(p);
+        cur = p;
+        p = grandparent;
+    }
+    return {left, right};
+}
+
+index EulerTourForest::reroot(index x) {
+    const auto parts = split(x, false);
+    return merge(parts.second, parts.first);
+}
+
+index EulerTourForest::treeOf(node u) const {
+    return vertex[u] == none ? elements.size() + u : root(vertex[u]);
+}
+
+count EulerTourForest::treeSize(node u) const {
+    return vertex[u] == none ? 1 : elements[root(vertex[u])].nodes;
+}
+
+node EulerTourForest::smallestNode(node u) const {
+    return vertex[u] == none ? u : elements[root(vertex[u])].minNode;
+}
+
+void EulerTourForest::link(node u, node v) {
+    const index x = vertexElement(u), y = vertexElement(v);
+    const index uv = newElement(u, v), vu = newElement(v, u);
+    arcs[Edge(u, v, true)] = u < v ? std::make_pair(uv, vu) : std::make_pair(vu, uv);
+
+    // The tour of u, the arc to v, the tour of v and the arc back to u.
+    merge(merge(merge(reroot(x), uv), reroot(y)), vu);
+}
+
+void EulerTourForest::cut(node u, node v) {
+    const auto it = arcs.find(Edge(u, v, true));
+    index first = it->second.first, second = it->second.second;
+    arcs.erase(it);
+    if (position(first) > position(second))
+        std::swap(first, second);
+
+    // The tour is A, first, B, second, C; B is the tour of one of the two trees, A and C together
+    // form the tour of the other one.
+    const index a = split(first, false).first;
+    split(first, true);
+    split(second, false);
+    const index c = split(second, true).second;
+    merge(a, c);
+
+    freeElement(first);
+    freeElement(second);
+}
+
+void EulerTourForest::markNode(node u, bool marked) {
+    if (!marked && vertex[u] == none)
+        return;
+    const index x = vertexElement(u);
+    elements[x].marked = marked;
+    updatePath(x);
+}
+
+void EulerTourForest::markEdge(node u, node v, bool marked) {
+    const index x = arcs.at(Edge(u, v, true)).first;
+    elements[x].marked = marked;
+    updatePath(x);
+}
+
+template <typename F>
+void EulerTourForest::forSubtree(index r, bool arcMarks, F handle) const {
+    auto hasMarks = [&](index x) {
+        return x != none && (arcMarks ? elements[x].arcMarks : elements[x].nodeMarks);
+    };
+    if (!hasMarks(r))
+        return;
+    std::vector<index> stack{r};
+    while (!stack.empty()) {
+        const index x = stack.back();
+        stack.pop_back();
+        const Element &e = elements[x];
+        if (e.marked && e.isNode() != arcMarks)
+            handle(e);
+        for (index c : {e.left, e.right})
+            if (hasMarks(c))
+                stack.push_back(c);
+    }
+}
+
+std::vector<node> EulerTourForest::markedNodes(node u) const {
+    std::vector<node> result;
+    if (vertex[u] != none)
+        forSubtree(root(vertex[u]), false, [&](const Element &e) { result.push_back(e.from); });
+    return result;
+}
+
+std::vector<Edge> EulerTourForest::markedEdges(node u) const {
+    std::vector<Edge> result;
+    if (vertex[u] != none)
+        forSubtree(root(vertex[u]), true,
+                   [&](const Element &e) { result.emplace_back(e.from, e.to, true); });
+    return result;
+}
+
+} // namespace NetworKit
@@ -10,8 +10,10 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <unordered_map>
 
 #include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/structures/CompactCover.hpp>
 #include <networkit/structures/Partition.hpp>
 
 namespace NetworKit {
@@ -68,21 +70,55 @@ count Partition::numberOfSubsets() const {
 
 void Partition::compact(bool useTurbo) {
     index i = 0;
-    if (!useTurbo) {
-        std::vector<index> usedIds(data);
-        Aux::Parallel::sort(usedIds.begin(), usedIds.end());
-        auto last = std::unique(usedIds.begin(), usedIds.end());
-        usedIds.erase(last, usedIds.end());
-        i = usedIds.size();
+    const index upper = subsetIdBound();
+    if (!CompactCover::isDenseIdRange(upper, z)) {
+        // Sparse ids, e.g., hashes, are renumbered without arrays indexed by id.
+        if (useTurbo) {
+            // Keep the order of first occurrence, as for dense ids.
+            std::unordered_map<index, index> compactingMap;
+            this->forEntries([&](index, index s) {
+                if (s != none && compactingMap.emplace(s, i).second)
+                    ++i;
+            });
+            this->parallelForEntries([&](index e, index s) {
+                if (s != none)
+                    data[e] = compactingMap.at(s);
+            });
+        } else {
+            std::vector<index> usedIds(data);
+            Aux::Parallel::sort(usedIds.begin(), usedIds.end());
+            usedIds.erase(std::unique(usedIds.begin(), usedIds.end()), usedIds.end());
+            if (!usedIds.empty() && usedIds.back() == none)
+                usedIds.pop_back();
+            i = usedIds.size();
+
+            this->parallelForEntries([&](index e, index s) {
+                if (s != none) {
+                    data[e] = std::distance(usedIds.begin(),
+                                            std::lower_bound(usedIds.begin(), usedIds.end(), s));
+                }
+            });
+        }
+    } else if (!useTurbo) {
+        // Renumber the used ids in increasing order by a prefix sum over the used flags.
+        std::vector<index> compactingMap(upper, 0);
+        this->parallelForEntries([&](index, index s) {
+            if (s != none)
+                compactingMap[s] = 1;
+        });
+        for (index s = 0; s < upper; ++s) {
+            const index used = compactingMap[s];
+            compactingMap[s] = i;
+            i += used;
+        }
 
         this->parallelForEntries([&](index e, index s) { // replace old SubsetIDs with the new IDs
             if (s != none) {
-                data[e] = std::distance(usedIds.begin(),
-                                        std::lower_bound(usedIds.begin(), usedIds.end(), s));
+                data[e] = compactingMap[s];
             }
         });
     } else {
-        std::vector<index> compactingMap(this->upperBound(), none);
+        std::vector<index> compactingMap(upper, none);
         this->forEntries([&](index, index s) {
             if (s != none && compactingMap[s] == none) {
                 compactingMap[s] = i++;
@@ -97,26 +133,62 @@ void Partition::compact(bool useTurbo) {
     this->setUpperBound(i);
 }
 
-std::vector<count> Partition::subsetSizes() const {
-    std::vector<count> sizes;
-    std::map<index, count> map = this->subsetSizeMap();
-    sizes.reserve(map.size());
-    for (auto kv : map) {
-        sizes.push_back(kv.second);
+index Partition::subsetIdBound() const {
+    index bound = upperBound();
+#ifndef NETWORKIT_OMP2
+#pragma omp parallel for reduction(max : bound)
+    for (omp_index e = 0; e < static_cast<omp_index>(z); ++e) {
+        if (data[e] != none)
+            bound = std::max(bound, data[e] + 1);
     }
-    return sizes;
+#else
+    for (const index s : data) {
+        if (s != none)
+            bound = std::max(bound, s + 1);
+    }
+#endif
+    return bound;
 }
 
-std::map<index, count> Partition::subsetSizeMap() const {
-    std::map<index, count> subset2size;
-
-    this->forEntries([&](index, index s) {
-        if (s != none) {
-            subset2size[s] += 1;
+std::vector<std::pair<index, count>> Partition::subsetIdsAndSizes() const {
+    std::vector<std::pair<index, count>> result;
+    const index upper = subsetIdBound();
+    if (!CompactCover::isDenseIdRange(upper, z)) {
+        // Sparse ids: count the runs of equal ids in a sorted copy.
+        std::vector<index> ids(data);
+        Aux::Parallel::sort(ids.begin(), ids.end());
+        for (index i = 0, j = 0; i < ids.size() && ids[i] != none; i = j) {
+            while (j < ids.size() && ids[j] == ids[i])
+                ++j;
+            result.emplace_back(ids[i], j - i);
         }
+        return result;
+    }
+
+    std::unique_ptr<std::atomic<count>[]> sizes(new std::atomic<count>[upper] {});
+    this->parallelForEntries([&](index, index s) {
+        if (s != none)
+            sizes[s].fetch_add(1, std::memory_order_relaxed);
     });
+    for (index s = 0; s < upper; ++s) {
+        const count size = sizes[s].load(std::memory_order_relaxed);
+        if (size > 0)
+            result.emplace_back(s, size);
+    }
+    return result;
+}
 
-    return subset2size;
+std::vector<count> Partition::subsetSizes() const {
+    const auto idsAndSizes = subsetIdsAndSizes();
+    std::vector<count> sizes(idsAndSizes.size());
+    for (index i = 0; i < idsAndSizes.size(); ++i)
+        sizes[i] = idsAndSizes[i].second;
+    return sizes;
+}
+
+std::map<index, count> Partition::subsetSizeMap() const {
+    const auto idsAndSizes = subsetIdsAndSizes();
+    return std::map<index, count>(idsAndSizes.begin(), idsAndSizes.end());
 }
 
 std::set<index> Partition::getMembers(index s) const {
@@ -135,18 +207,11 @@ std::vector<index> Partition::getVector() const {
 }
 
 std::set<std::set<index>> Partition::getSubsets() const {
-    std::vector<std::set<index>> table(omega + 1);
-    this->forEntries([&](index e, index s) {
-        assert(s <= omega);
-        table[s].insert(e);
-    });
-
+    const CompactCover members(*this);
     std::set<std::set<index>> subsets;
-    for (const auto &set : table) {
-        if (!set.empty()) {
-            subsets.insert(set);
-        }
-    }
+    members.forSubsets([&](index s) {
+        subsets.emplace(members.membersOf(s), members.membersOf(s) + members.subsetSize(s));
+    });
     return subsets;
 }
 
@@ -157,10 +222,8 @@ void Partition::allToOnePartition() {
 
 std::set<index> Partition::getSubsetIds() const {
     std::set<index> ids;
-    for (index id : data) {
-        if (id != none) {
-            ids.insert(id);
-        }
+    for (const auto &idAndSize : subsetIdsAndSizes()) {
+        ids.emplace_hint(ids.end(), idAndSize.first);
     }
     return ids;
 }
@@ -0,0 +1,169 @@
+/*
+ * CompactCoverGTest.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+// networkit-format
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/structures/CompactCover.hpp>
+
+namespace NetworKit {
+
+class CompactCoverGTest : public testing::Test {};
+
+TEST_F(CompactCoverGTest, testFromCover) {
+    Aux::Random::setSeed(42, false);
+    const count n = 500, k = 40;
+    Cover cover(n);
+    cover.setUpperBound(k);
+    std::vector<std::vector<index>> expected(k);
+    for (index e = 0; e < n; ++e) {
+        for (index s = 0; s < k; ++s) {
+            if (Aux::Random::real() < 0.1) {
+                cover.addToSubset(s, e);
+                expected[s].push_back(e);
+            }
+        }
+    }
+
+    const CompactCover compact(cover);
+    EXPECT_EQ(n, compact.numberOfElements());
+    EXPECT_EQ(k, compact.upperBound());
+    EXPECT_EQ(cover.numberOfSubsets(), compact.numberOfSubsets());
+
+    count memberships = 0;
+    for (index s = 0; s < k; ++s) {
+        ASSERT_EQ(expected[s].size(), compact.subsetSize(s));
+        EXPECT_TRUE(std::equal(expected[s].begin(), expected[s].end(), compact.membersOf(s)));
+        memberships += expected[s].size();
+    }
+    EXPECT_EQ(memberships, compact.numberOfMemberships());
+
+    for (index e = 0; e < n; ++e) {
+        ASSERT_EQ(cover[e].size(), compact.numberOfSubsetsOf(e));
+        EXPECT_TRUE(std::equal(cover[e].begin(), cover[e].end(), compact.subsetsOf(e)));
+    }
+}
+
+TEST_F(CompactCoverGTest, testFromPartitionWithUnassignedElements) {
+    Partition p(6);
+    p.setUpperBound(4);
+    p[0] = 3;
+    p[2] = 1;
+    p[3] = 3;
+    p[5] = 3;
+
+    const CompactCover compact(p);
+    EXPECT_EQ(4u, compact.upperBound());
+    EXPECT_EQ(2u, compact.numberOfSubsets());
+    EXPECT_EQ(4u, compact.numberOfMemberships());
+    EXPECT_EQ(std::vector<count>({0, 1, 0, 3}), compact.subsetSizes());
+
+    std::vector<index> members;
+    compact.forMembersOf(3, [&](index e) { members.push_back(e); });
+    EXPECT_EQ(std::vector<index>({0, 3, 5}), members);
+    EXPECT_EQ(0u, compact.numberOfSubsetsOf(1));
+    EXPECT_EQ(1u, compact.numberOfSubsetsOf(2));
+    EXPECT_EQ(1u, compact.subsetsOf(2)[0]);
+
+    count visited = 0;
+    compact.parallelForSubsets([&](index s) {
+#pragma omp atomic
+        visited += s;
+    });
+    EXPECT_EQ(4u, visited);
+}
+
+TEST_F(CompactCoverGTest, testPartitionSizesAndCompact) {
+    Aux::Random::setSeed(42, false);
+    const count n = 1000, k = 100;
+    Partition p(n);
+    p.setUpperBound(k);
+    std::map<index, count> expected;
+    for (index e = 0; e < n; ++e) {
+        // Only every third subset id is used, some elements remain unassigned.
+        if (Aux::Random::real() < 0.9) {
+            p[e] = 3 * Aux::Random::integer(k / 3 - 1);
+            ++expected[p[e]];
+        }
+    }
+
+    EXPECT_EQ(expected, p.subsetSizeMap());
+    std::set<index> ids;
+    std::vector<count> sizes;
+    for (const auto &idAndSize : expected) {
+        ids.insert(idAndSize.first);
+        sizes.push_back(idAndSize.second);
+    }
+    EXPECT_EQ(ids, p.getSubsetIds());
+    EXPECT_EQ(sizes, p.subsetSizes());
+
+    // Compacting preserves the order of the ids and ignores unassigned elements.
+    Partition q(p);
+    q.compact();
+    EXPECT_EQ(expected.size(), q.upperBound());
+    EXPECT_EQ(sizes, q.subsetSizes());
+    for (index e = 0; e < n; ++e) {
+        if (p[e] == none) {
+            EXPECT_EQ(none, q[e]);
+        } else {
+            EXPECT_EQ(static_cast<index>(std::distance(ids.begin(), ids.find(p[e]))), q[e]);
+        }
+    }
+}
+
+TEST_F(CompactCoverGTest, testSparseSubsetIds) {
+    // Ids like hashes must not lead to arrays indexed by id.
+    const index big = 999999999, huge = none - 2;
+    Partition p(6);
+    p.setUpperBound(huge + 1);
+    p[0] = big;
+    p[1] = 0;
+    p[2] = huge;
+    p[3] = big;
+    p[5] = huge;
+
+    const std::map<index, count> expected{{0, 1}, {big, 2}, {huge, 2}};
+    EXPECT_EQ(expected, p.subsetSizeMap());
+    EXPECT_EQ(std::set<index>({0, big, huge}), p.getSubsetIds());
+    EXPECT_EQ(std::vector<count>({1, 2, 2}), p.subsetSizes());
+    EXPECT_EQ(std::set<std::set<index>>({{1}, {0, 3}, {2, 5}}), p.getSubsets());
+
+    const CompactCover compact(p);
+    EXPECT_EQ(3u, compact.numberOfSubsets());
+    EXPECT_EQ(huge + 1, compact.upperBound());
+    EXPECT_EQ(2u, compact.subsetSize(big));
+    EXPECT_EQ(0u, compact.subsetSize(big + 1));
+    EXPECT_EQ(std::vector<index>({2, 5}),
+              std::vector<index>(compact.membersOf(huge), compact.membersOf(huge) + 2));
+    std::vector<index> ids;
+    compact.forSubsets([&](index s) { ids.push_back(s); });
+    EXPECT_EQ(std::vector<index>({0, big, huge}), ids);
+
+    Partition q(p);
+    q.compact();
+    EXPECT_EQ(3u, q.upperBound());
+    EXPECT_EQ(std::vector<index>({1, 0, 2, 1, none, 2}), q.getVector());
+
+    Partition turbo(p);
+    turbo.compact(true);
+    EXPECT_EQ(3u, turbo.upperBound());
+    EXPECT_EQ(std::vector<index>({0, 1, 2, 0, none, 2}), turbo.getVector());
+
+    Cover cover(p);
+    cover.addToSubset(big, 1);
+    EXPECT_EQ(std::set<index>({0, big, huge}), cover.getSubsetIds());
+    const std::map<index, count> expectedCover{{0, 1}, {big, 3}, {huge, 2}};
+    EXPECT_EQ(expectedCover, cover.subsetSizeMap());
+    EXPECT_EQ(std::vector<count>({3, 1, 2}), cover.subsetSizes());
+}
+
+} // namespace NetworKit
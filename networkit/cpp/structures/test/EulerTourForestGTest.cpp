@@ -0,0 +1,127 @@
+/*
+ * EulerTourForestGTest.cpp
+ *
+ *  Created on: 19.10.2026
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/structures/EulerTourForest.hpp>
+#include <networkit/structures/UnionFind.hpp>
+
+namespace NetworKit {
+
+class EulerTourForestGTest : public testing::Test {};
+
+TEST_F(EulerTourForestGTest, testLinkCut) {
+    EulerTourForest forest(6);
+    EXPECT_FALSE(forest.connected(0, 1));
+    EXPECT_EQ(forest.treeSize(3), 1);
+    EXPECT_EQ(forest.smallestNode(3), 3);
+
+    forest.link(0, 1);
+    forest.link(2, 1);
+    forest.link(3, 4);
+    EXPECT_TRUE(forest.connected(0, 2));
+    EXPECT_FALSE(forest.connected(0, 3));
+    EXPECT_EQ(forest.treeSize(2), 3);
+    EXPECT_EQ(forest.smallestNode(4), 3);
+    EXPECT_TRUE(forest.hasEdge(1, 2));
+
+    forest.link(4, 2);
+    EXPECT_TRUE(forest.connected(0, 3));
+    EXPECT_EQ(forest.treeSize(0), 5);
+    EXPECT_EQ(forest.smallestNode(4), 0);
+
+    forest.cut(1, 2);
+    EXPECT_FALSE(forest.hasEdge(1, 2));
+    EXPECT_TRUE(forest.connected(0, 1));
+    EXPECT_TRUE(forest.connected(2, 3));
+    EXPECT_FALSE(forest.connected(1, 2));
+    EXPECT_EQ(forest.treeSize(0), 2);
+    EXPECT_EQ(forest.treeSize(4), 3);
+    EXPECT_EQ(forest.smallestNode(4), 2);
+
+    forest.addNodes(8);
+    EXPECT_EQ(forest.numberOfNodes(), 8);
+    forest.link(7, 0);
+    EXPECT_TRUE(forest.connected(7, 1));
+}
+
+TEST_F(EulerTourForestGTest, testMarks) {
+    EulerTourForest forest(6);
+    forest.link(0, 1);
+    forest.link(1, 2);
+    forest.link(3, 4);
+    forest.markNode(2, true);
+    forest.markNode(0, true);
+    forest.markNode(4, true);
+    forest.markNode(5, false);
+    forest.markEdge(2, 1, true);
+
+    std::vector<node> nodes = forest.markedNodes(1);
+    std::sort(nodes.begin(), nodes.end());
+    EXPECT_EQ(nodes, std::vector<node>({0, 2}));
+    EXPECT_TRUE(forest.markedNodes(5).empty());
+
+    const std::vector<Edge> edges = forest.markedEdges(0);
+    ASSERT_EQ(edges.size(), 1);
+    EXPECT_EQ(edges[0], Edge(1, 2));
+    EXPECT_TRUE(forest.markedEdges(3).empty());
+
+    forest.markNode(0, false);
+    forest.cut(0, 1);
+    EXPECT_TRUE(forest.markedNodes(0).empty());
+    EXPECT_EQ(forest.markedNodes(2), std::vector<node>({2}));
+
+    // Marks move with the nodes when trees are linked.
+    forest.link(2, 3);
+    nodes = forest.markedNodes(4);
+    std::sort(nodes.begin(), nodes.end());
+    EXPECT_EQ(nodes, std::vector<node>({2, 4}));
+}
+
+TEST_F(EulerTourForestGTest, testRandomLinksAndCuts) {
+    Aux::Random::setSeed(42, false);
+    const count n = 300;
+    EulerTourForest forest(n);
+    std::vector<Edge> treeEdges;
+
+    for (index round = 0; round < 3000; ++round) {
+        if (treeEdges.empty() || Aux::Random::real() < 0.6) {
+            const node u = Aux::Random::index(n), v = Aux::Random::index(n);
+            if (!forest.connected(u, v)) {
+                forest.link(u, v);
+                treeEdges.emplace_back(u, v);
+            }
+        } else {
+            const index i = Aux::Random::index(treeEdges.size());
+            forest.cut(treeEdges[i].u, treeEdges[i].v);
+            treeEdges[i] = treeEdges.back();
+            treeEdges.pop_back();
+        }
+
+        if (round % 100 != 0)
+            continue;
+        UnionFind expected(n);
+        for (const Edge &e : treeEdges)
+            expected.merge(e.u, e.v);
+        std::vector<count> sizes(n, 0);
+        std::vector<node> smallest(n, none);
+        for (node u = 0; u < n; ++u) {
+            ++sizes[expected.find(u)];
+            smallest[expected.find(u)] = std::min(smallest[expected.find(u)], u);
+        }
+        for (node u = 0; u < n; ++u) {
+            EXPECT_EQ(forest.treeSize(u), sizes[expected.find(u)]);
+            EXPECT_EQ(forest.smallestNode(u), smallest[expected.find(u)]);
+            const node v = (u * 7 + round) % n;
+            EXPECT_EQ(forest.connected(u, v), expected.find(u) == expected.find(v));
+        }
+    }
+}
+
+} // namespace NetworKit
@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/structures/ConcurrentUnionFind.hpp>
 #include <networkit/structures/UnionFind.hpp>
 
 
@@ -73,4 +75,55 @@ TEST_F(UnionFindGTest, testMergeCircular) {
     }
 }
 
+TEST_F(UnionFindGTest, testConcurrentUnite) {
+    ConcurrentUnionFind p(10);
+    EXPECT_TRUE(p.unite(3, 8));
+    EXPECT_FALSE(p.unite(8, 3));
+    EXPECT_TRUE(p.unite(8, 5));
+    EXPECT_TRUE(p.inSameSet(3, 5));
+    EXPECT_FALSE(p.inSameSet(3, 4));
+
+    // Without randomized linking, every set is represented by its smallest element.
+    p.compress();
+    EXPECT_EQ(p.find(8), 3);
+    EXPECT_EQ(p.find(5), 3);
+    EXPECT_EQ(p.find(4), 4);
+
+    Partition part = p.toPartition();
+    EXPECT_EQ(part.numberOfSubsets(), 8);
+    EXPECT_EQ(part[5], part[8]);
+    EXPECT_NE(part[4], part[8]);
+
+    p.allToSingletons();
+    EXPECT_FALSE(p.inSameSet(3, 8));
+}
+
+TEST_F(UnionFindGTest, testConcurrentUniteAll) {
+    Aux::Random::setSeed(42, false);
+    const count n = 5000;
+    std::vector<std::pair<index, index>> pairs;
+    for (index i = 0; i < 4000; ++i)
+        pairs.emplace_back(Aux::Random::index(n), Aux::Random::index(n));
+
+    UnionFind expected(n);
+    count expectedMerges = 0;
+    for (auto pair : pairs) {
+        expectedMerges += expected.find(pair.first) != expected.find(pair.second);
+        expected.merge(pair.first, pair.second);
+    }
+
+    for (bool randomized : {false, true}) {
+        ConcurrentUnionFind p(n, randomized);
+        EXPECT_EQ(p.uniteAll(pairs), expectedMerges);
+
+        Partition part = p.toPartition();
+        EXPECT_EQ(part.numberOfSubsets(), n - expectedMerges);
+        for (index u = 0; u < n; ++u) {
+            EXPECT_EQ(p.find(u), part[u]);
+            for (index v : {index{0}, (u + 1) % n, pairs[u % pairs.size()].first})
+                EXPECT_EQ(p.inSameSet(u, v), expected.find(u) == expected.find(v));
+        }
+    }
+}
+
 } /* namespace NetworKit */
@@ -118,8 +118,9 @@ cdef class GraphDifference(Algorithm):
 	Both graphs need to have the same node set, directed graphs are not
 	supported currently.
 
-	Note that edge weight differences are not detected but edge
-	addition events set the correct edge weight.
+	Edge weight differences are reported as edge weight updates. The
+	difference is computed in parallel, and the result does not depend
+	on the number of threads.
 
 	Parameters:
 	-----------
@@ -76,7 +76,8 @@ cdef class ClusteringCoefficient:
 
 	@staticmethod
 	def exactGlobal(Graph G):
-		""" This calculates the global clustering coefficient. """
+		""" This calculates the global clustering coefficient. In undirected graphs, self-loops
+		are ignored; in directed graphs, wedges are formed by the out-neighborhoods. """
 		cdef double ret
 		with nogil:
 			ret = exactGlobal(G._this)
@@ -18,6 +18,7 @@ cdef extern from "<networkit/scd/PageRankNibble.hpp>":
 	cdef cppclass _PageRankNibble "NetworKit::PageRankNibble":
 		_PageRankNibble(_Graph G, double alpha, double epsilon) except +
 		map[node, set[node]] run(set[node] seeds) except +
+		void setBudget(index maxNodes)
 
 cdef class PageRankNibble:
 	"""
@@ -47,11 +48,23 @@ cdef class PageRankNibble:
 		"""
 		return self._this.run(seeds)
 
+	def setBudget(self, index maxNodes):
+		"""
+		Limits the work per seed: the expansion of a seed stops early once it has reached maxNodes
+		nodes.
+
+		Parameters:
+		-----------
+		maxNodes : the maximum number of nodes per seed.
+		"""
+		self._this.setBudget(maxNodes)
+
 cdef extern from "<networkit/scd/GCE.hpp>":
 
 	cdef cppclass _GCE "NetworKit::GCE":
 		_GCE(_Graph G, string quality) except +
 		map[node, set[node]] run(set[node] seeds) except +
+		void setBudget(index maxNodes)
 
 cdef class GCE:
 	"""
@@ -78,3 +91,14 @@ cdef class GCE:
 		"""
 		return self._this.run(seeds)
 
+	def setBudget(self, index maxNodes):
+		"""
+		Limits the work per seed: the expansion of a seed stops early once it has reached maxNodes
+		nodes.
+
+		Parameters:
+		-----------
+		maxNodes : the maximum number of nodes per seed.
+		"""
+		self._this.setBudget(maxNodes)
+
@@ -146,6 +146,83 @@ cdef class TriangleEdgeScore(EdgeScore):
 	cdef bool_t isDoubleValue(self):
 		return False
 
+cdef extern from "<networkit/edgescores/TrussDecomposition.hpp>":
+
+	cdef cppclass _TrussDecomposition "NetworKit::TrussDecomposition"(_EdgeScore[count]):
+		_TrussDecomposition(const _Graph& G) except +
+		count maxTrussness() except +
+		vector[edgeid] getEdgeOrder() except +
+		vector[index] getTrussOffsets() except +
+		vector[edgeid] getEdgesOfTruss(count k) except +
+
+cdef class TrussDecomposition(EdgeScore):
+	"""
+	Computes the k-truss decomposition of an undirected graph. The score of each edge is its
+	trussness, i.e., the largest k such that the edge belongs to a subgraph in which every edge is
+	part of at least k - 2 triangles. The edges of the graph need to be indexed.
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The graph.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _TrussDecomposition(G._this)
+
+	cdef bool_t isDoubleValue(self):
+		return False
+
+	def maxTrussness(self):
+		"""
+		Returns the maximum trussness of any edge.
+
+		Returns:
+		--------
+		int
+			The maximum trussness.
+		"""
+		return (<_TrussDecomposition*>(self._this)).maxTrussness()
+
+	def getEdgeOrder(self):
+		"""
+		Returns all edge ids sorted by increasing trussness.
+
+		Returns:
+		--------
+		list(int)
+			The edge ids in peeling order.
+		"""
+		return (<_TrussDecomposition*>(self._this)).getEdgeOrder()
+
+	def getTrussOffsets(self):
+		"""
+		Returns for each k the position in getEdgeOrder() of the first edge with trussness at least k.
+
+		Returns:
+		--------
+		list(int)
+			The offsets of the truss hierarchy.
+		"""
+		return (<_TrussDecomposition*>(self._this)).getTrussOffsets()
+
+	def getEdgesOfTruss(self, k):
+		"""
+		Returns the ids of all edges with trussness at least k.
+
+		Parameters:
+		-----------
+		k : int
+			The order of the truss.
+
+		Returns:
+		--------
+		list(int)
+			The edge ids of the k-truss.
+		"""
+		return (<_TrussDecomposition*>(self._this)).getEdgesOfTruss(k)
+
 cdef extern from "<networkit/edgescores/EdgeScoreLinearizer.hpp>":
 
 	cdef cppclass _EdgeScoreLinearizer "NetworKit::EdgeScoreLinearizer"(_EdgeScore[double]):